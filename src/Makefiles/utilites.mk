@@ -30,6 +30,7 @@ clean:
 	rm -rf ./gui/desktop.app
 	rm -f ./gui/*.o
 	rm -rf ./build
+	rm -f ./gui/headless/*.o ./gui/headless/Makefile ./gui/headless/.qmake.stash
 	rm -f ./gui/Makefile ./gui/desktop.pro.user ./gui/moc_predefs.h ./gui/ui_s21_ui.h ./gui/.qmake.stash ./gui/*.cpp
 	
 
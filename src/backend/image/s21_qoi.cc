@@ -0,0 +1,150 @@
+#include "s21_qoi.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Запись числа в порядке big-endian
+/// @param value Число
+/// @param out Выходные байты
+void putBig(std::uint32_t value, std::vector<std::uint8_t> &out) {
+  for (int i = 3; i >= 0; --i) {
+    out.push_back(static_cast<std::uint8_t>(value >> 8 * i));
+  }
+}
+
+/// @brief Чтение числа в порядке big-endian
+/// @param bytes Начало числа
+/// @return Число
+std::uint32_t getBig(const std::uint8_t *bytes) {
+  return static_cast<std::uint32_t>(bytes[0]) << 24 |
+         static_cast<std::uint32_t>(bytes[1]) << 16 |
+         static_cast<std::uint32_t>(bytes[2]) << 8 | bytes[3];
+}
+
+}  // namespace
+
+int QoiCodec::hash(const std::uint8_t *pixel) {
+  return (pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) %
+         QOI_INDEX;
+}
+
+void QoiCodec::encode(const std::uint8_t *pixels, int width, int height,
+                      int stride, std::vector<std::uint8_t> &out) {
+  const std::uint8_t magic[4] = {'q', 'o', 'i', 'f'};
+  out.insert(out.end(), magic, magic + 4);
+  putBig(static_cast<std::uint32_t>(width), out);
+  putBig(static_cast<std::uint32_t>(height), out);
+  out.push_back(3);
+  out.push_back(0);
+
+  std::uint8_t index[QOI_INDEX][4] = {};
+  std::uint8_t previous[4] = {0, 0, 0, 255};
+  std::uint8_t pixel[4] = {0, 0, 0, 255};
+  int run = 0;
+  for (int y = 0; y < height; ++y) {
+    const std::uint8_t *row = pixels + static_cast<std::ptrdiff_t>(y) * stride;
+    for (int x = 0; x < width; ++x) {
+      std::memcpy(pixel, row + x * 3, 3);
+      if (std::memcmp(pixel, previous, 4) == 0) {
+        if (++run == 62) {
+          out.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+          run = 0;
+        }
+        continue;
+      }
+      if (run) {
+        out.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+        run = 0;
+      }
+      int position = hash(pixel);
+      if (std::memcmp(index[position], pixel, 4) == 0) {
+        out.push_back(static_cast<std::uint8_t>(position));
+      } else {
+        std::memcpy(index[position], pixel, 4);
+        int dr = static_cast<std::int8_t>(pixel[0] - previous[0]);
+        int dg = static_cast<std::int8_t>(pixel[1] - previous[1]);
+        int db = static_cast<std::int8_t>(pixel[2] - previous[2]);
+        int drg = dr - dg;
+        int dbg = db - dg;
+        if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 &&
+            db <= 1) {
+          out.push_back(static_cast<std::uint8_t>(0x40 | (dr + 2) << 4 |
+                                                  (dg + 2) << 2 | (db + 2)));
+        } else if (dg >= -32 && dg <= 31 && drg >= -8 && drg <= 7 &&
+                   dbg >= -8 && dbg <= 7) {
+          out.push_back(static_cast<std::uint8_t>(0x80 | (dg + 32)));
+          out.push_back(static_cast<std::uint8_t>((drg + 8) << 4 | (dbg + 8)));
+        } else {
+          out.push_back(0xFE);
+          out.insert(out.end(), pixel, pixel + 3);
+        }
+      }
+      std::memcpy(previous, pixel, 4);
+    }
+  }
+  if (run) out.push_back(static_cast<std::uint8_t>(0xC0 | (run - 1)));
+  const std::uint8_t padding[8] = {0, 0, 0, 0, 0, 0, 0, 1};
+  out.insert(out.end(), padding, padding + 8);
+}
+
+bool QoiCodec::decode(const std::vector<std::uint8_t> &data, int &width,
+                      int &height, std::vector<std::uint8_t> &pixels) {
+  if (data.size() < QOI_HEADER + 8 ||
+      std::memcmp(data.data(), "qoif", 4) != 0) {
+    return false;
+  }
+  std::uint32_t w = getBig(data.data() + 4);
+  std::uint32_t h = getBig(data.data() + 8);
+  std::uint8_t channels = data[12];
+  std::uint32_t limit = std::numeric_limits<int>::max();
+  if (w == 0 || h == 0 || w > limit || h > limit ||
+      (channels != 3 && channels != 4)) {
+    return false;
+  }
+  width = static_cast<int>(w);
+  height = static_cast<int>(h);
+  std::size_t count = static_cast<std::size_t>(w) * h;
+  pixels.resize(count * 4);
+
+  std::uint8_t index[QOI_INDEX][4] = {};
+  std::uint8_t pixel[4] = {0, 0, 0, 255};
+  std::size_t end = data.size() - 8;
+  std::size_t p = QOI_HEADER;
+  int run = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (run > 0) {
+      --run;
+    } else if (p < end) {
+      std::uint8_t op = data[p++];
+      if (op == 0xFE) {
+        std::memcpy(pixel, &data[p], 3);
+        p += 3;
+      } else if (op == 0xFF) {
+        std::memcpy(pixel, &data[p], 4);
+        p += 4;
+      } else if ((op & 0xC0) == 0x00) {
+        std::memcpy(pixel, index[op], 4);
+      } else if ((op & 0xC0) == 0x40) {
+        pixel[0] += ((op >> 4) & 0x03) - 2;
+        pixel[1] += ((op >> 2) & 0x03) - 2;
+        pixel[2] += (op & 0x03) - 2;
+      } else if ((op & 0xC0) == 0x80) {
+        std::uint8_t next = data[p++];
+        int dg = (op & 0x3F) - 32;
+        pixel[0] += dg - 8 + ((next >> 4) & 0x0F);
+        pixel[1] += dg;
+        pixel[2] += dg - 8 + (next & 0x0F);
+      } else {
+        run = op & 0x3F;
+      }
+      std::memcpy(index[hash(pixel)], pixel, 4);
+    } else {
+      return false;
+    }
+    std::memcpy(&pixels[i * 4], pixel, 4);
+  }
+  return true;
+}
+
+}  // namespace s21
\ No newline at end of file
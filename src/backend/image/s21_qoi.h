@@ -0,0 +1,54 @@
+/// @mainpage
+/// @file s21_qoi.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_QOI_H
+#define S21_QOI_H
+
+#include "../../common/s21_common.h"
+
+/// @brief Размер заголовка QOI в байтах
+#define QOI_HEADER 14
+/// @brief Кол-во цветов в таблице недавних цветов QOI
+#define QOI_INDEX 64
+
+namespace s21 {
+
+/// @brief Кодек QOI для изображений RGB.
+/// Таблица недавних цветов хранит RGBA, как в эталонном кодировщике:
+/// записанные пиксели непрозрачны, а пустые ячейки имеют нулевую
+/// прозрачность, поэтому черный пиксель не совпадает с пустой ячейкой.
+class QoiCodec {
+ public:
+  /// @brief Кодирование изображения в QOI с каналами RGB
+  /// @param pixels Пиксели RGB сверху вниз
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param stride Байт в строке
+  /// @param out Файл QOI, дописывается в конец
+  static void encode(const std::uint8_t *pixels, int width, int height,
+                     int stride, std::vector<std::uint8_t> &out);
+  /// @brief Декодирование QOI в пиксели RGBA без выравнивания строк
+  /// @param data Файл QOI
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param pixels Пиксели RGBA сверху вниз
+  /// @return false, если файл поврежден
+  static bool decode(const std::vector<std::uint8_t> &data, int &width,
+                     int &height, std::vector<std::uint8_t> &pixels);
+
+ private:
+  /// @brief Позиция цвета в таблице недавних цветов
+  /// @param pixel Пиксель RGBA
+  /// @return Позиция от 0 до QOI_INDEX - 1
+  static int hash(const std::uint8_t *pixel);
+};
+
+}  // namespace s21
+
+#endif  // S21_QOI_H
\ No newline at end of file
@@ -0,0 +1,292 @@
+#include "s21_clusters.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Разреживание битов: bbbbb -> b00b00b00b00b
+unsigned int spreadBits(unsigned int value) {
+  unsigned int result = 0;
+  for (unsigned int bit = 0; bit < CLUSTER_MAX_LEVEL; ++bit) {
+    result |= ((value >> bit) & 1u) << (bit * 3);
+  }
+  return result;
+}
+
+/// @brief Номер ячейки координаты на сетке
+unsigned int cellIndex(float value, float min, float scale,
+                       unsigned int resolution) {
+  float cell = (value - min) * scale;
+  if (!(cell > 0.0f)) return 0;
+  return std::min(static_cast<unsigned int>(cell), resolution - 1);
+}
+
+/// @brief Расширение параллелепипеда точкой
+void expand(Cluster_t &cluster, const Vertex_t &vertex) {
+  cluster.min.x = std::min(cluster.min.x, vertex.x);
+  cluster.min.y = std::min(cluster.min.y, vertex.y);
+  cluster.min.z = std::min(cluster.min.z, vertex.z);
+  cluster.max.x = std::max(cluster.max.x, vertex.x);
+  cluster.max.y = std::max(cluster.max.y, vertex.y);
+  cluster.max.z = std::max(cluster.max.z, vertex.z);
+}
+
+/// @brief Глубина сетки для заданного кол-ва ребер
+unsigned int gridLevel(std::size_t edges) {
+  unsigned int level = 0;
+  while (level < CLUSTER_MAX_LEVEL &&
+         (std::size_t(1) << (3 * (level + 1))) * CLUSTER_EDGES <= edges) {
+    ++level;
+  }
+  return level;
+}
+
+}  // namespace
+
+void EdgeClusters::build(const std::vector<Vertex_t> &vertices,
+                         const std::vector<Edge_t> &sourceEdges) {
+  clear();
+  unsigned int level = gridLevel(sourceEdges.size());
+  std::size_t cells = std::size_t(1) << (3 * level);
+  std::vector<unsigned int> keys = cellKeys(vertices, sourceEdges, level);
+
+  std::size_t chunks = parallelWorkers(sourceEdges.size());
+  std::vector<std::size_t> offsets(cells * chunks, 0);
+  parallelForChunks(sourceEdges.size(), chunks,
+                    [&keys, &offsets, chunks](std::size_t chunk,
+                                              std::size_t begin,
+                                              std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        ++offsets[keys[i] * chunks + chunk];
+                      }
+                    });
+  std::vector<std::size_t> counts(cells, 0);
+  for (std::size_t cell = 0; cell < cells; ++cell) {
+    for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+      counts[cell] += offsets[cell * chunks + chunk];
+    }
+  }
+  parallelExclusiveScan(offsets);
+
+  edges.resize(sourceEdges.size());
+  parallelForChunks(sourceEdges.size(), chunks,
+                    [this, &sourceEdges, &keys, &offsets, chunks](
+                        std::size_t chunk, std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        edges[offsets[keys[i] * chunks + chunk]++] =
+                            sourceEdges[i];
+                      }
+                    });
+
+  std::size_t offset = 0;
+  for (std::size_t cell = 0; cell < cells; ++cell) {
+    if (counts[cell] > 0) {
+      clusters.push_back(
+          {offset, counts[cell], 0, 0, 0, 0, Vertex_t(), Vertex_t()});
+      offset += counts[cell];
+    }
+  }
+  computeBounds(vertices);
+  stripify();
+  built = true;
+}
+
+void EdgeClusters::clear() {
+  edges.clear();
+  edges.shrink_to_fit();
+  clusters.clear();
+  clusters.shrink_to_fit();
+  stripIndices.clear();
+  stripIndices.shrink_to_fit();
+  stripStarts.clear();
+  stripStarts.shrink_to_fit();
+  built = false;
+}
+
+bool EdgeClusters::isBuilt() const { return built; }
+
+const std::vector<Edge_t> &EdgeClusters::getEdges() const { return edges; }
+
+const std::vector<Cluster_t> &EdgeClusters::getClusters() const {
+  return clusters;
+}
+
+const std::vector<unsigned int> &EdgeClusters::getStripIndices() const {
+  return stripIndices;
+}
+
+const std::vector<std::size_t> &EdgeClusters::getStripStarts() const {
+  return stripStarts;
+}
+
+std::vector<unsigned int> EdgeClusters::cellKeys(
+    const std::vector<Vertex_t> &vertices, const std::vector<Edge_t> &edges,
+    unsigned int level) {
+  std::vector<unsigned int> keys(edges.size(), 0);
+  if (level == 0 || vertices.empty()) return keys;
+
+  Cluster_t bounds = {0, 0, 0, 0, 0, 0, vertices.front(), vertices.front()};
+  for (const Vertex_t &vertex : vertices) {
+    expand(bounds, vertex);
+  }
+  unsigned int resolution = 1u << level;
+  auto scale = [resolution](float min, float max) {
+    return max > min ? resolution / (max - min) : 0.0f;
+  };
+  float scaleX = scale(bounds.min.x, bounds.max.x);
+  float scaleY = scale(bounds.min.y, bounds.max.y);
+  float scaleZ = scale(bounds.min.z, bounds.max.z);
+
+  parallelFor(edges.size(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      const Edge_t &edge = edges[i];
+      if (edge.indSecond >= vertices.size()) continue;
+      const Vertex_t &first = vertices[edge.indFirst];
+      const Vertex_t &second = vertices[edge.indSecond];
+      unsigned int x = cellIndex((first.x + second.x) * 0.5f, bounds.min.x,
+                                 scaleX, resolution);
+      unsigned int y = cellIndex((first.y + second.y) * 0.5f, bounds.min.y,
+                                 scaleY, resolution);
+      unsigned int z = cellIndex((first.z + second.z) * 0.5f, bounds.min.z,
+                                 scaleZ, resolution);
+      keys[i] = spreadBits(x) | (spreadBits(y) << 1) | (spreadBits(z) << 2);
+    }
+  });
+  return keys;
+}
+
+void EdgeClusters::computeBounds(const std::vector<Vertex_t> &vertices) {
+  parallelFor(
+      clusters.size(),
+      [this, &vertices](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          Cluster_t &cluster = clusters[i];
+          bool empty = true;
+          for (std::size_t j = cluster.offset;
+               j < cluster.offset + cluster.count; ++j) {
+            if (edges[j].indSecond >= vertices.size()) continue;
+            const Vertex_t &first = vertices[edges[j].indFirst];
+            if (empty) cluster.min = cluster.max = first;
+            empty = false;
+            expand(cluster, first);
+            expand(cluster, vertices[edges[j].indSecond]);
+          }
+        }
+      },
+      PARALLEL_GRAIN / CLUSTER_EDGES);
+}
+
+void EdgeClusters::stripify() {
+  std::vector<std::vector<unsigned int>> indices(clusters.size());
+  std::vector<std::vector<std::size_t>> starts(clusters.size());
+  parallelFor(
+      clusters.size(),
+      [this, &indices, &starts](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          stripifyCluster(i, indices[i], starts[i]);
+        }
+      },
+      PARALLEL_GRAIN / CLUSTER_EDGES);
+
+  std::size_t indexOffset = 0;
+  std::size_t firstStrip = 0;
+  for (std::size_t i = 0; i < clusters.size(); ++i) {
+    clusters[i].indexOffset = indexOffset;
+    clusters[i].indexCount = indices[i].size();
+    clusters[i].firstStrip = firstStrip;
+    clusters[i].strips = starts[i].size();
+    indexOffset += indices[i].size();
+    firstStrip += starts[i].size();
+  }
+  stripIndices.resize(indexOffset);
+  stripStarts.resize(firstStrip + 1);
+  stripStarts.back() = indexOffset;
+  parallelFor(
+      clusters.size(),
+      [this, &indices, &starts](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          const Cluster_t &cluster = clusters[i];
+          std::copy(indices[i].begin(), indices[i].end(),
+                    stripIndices.begin() + cluster.indexOffset);
+          for (std::size_t j = 0; j < starts[i].size(); ++j) {
+            stripStarts[cluster.firstStrip + j] =
+                cluster.indexOffset + starts[i][j];
+          }
+          std::vector<unsigned int>().swap(indices[i]);
+        }
+      },
+      PARALLEL_GRAIN / CLUSTER_EDGES);
+}
+
+void EdgeClusters::stripifyCluster(std::size_t index,
+                                   std::vector<unsigned int> &indices,
+                                   std::vector<std::size_t> &starts) const {
+  const Cluster_t &cluster = clusters[index];
+  const Edge_t *local = edges.data() + cluster.offset;
+  std::vector<std::pair<unsigned int, unsigned int>> incidence;
+  incidence.reserve(cluster.count * 2);
+  for (unsigned int i = 0; i < cluster.count; ++i) {
+    incidence.push_back({local[i].indFirst, i});
+    incidence.push_back({local[i].indSecond, i});
+  }
+  std::sort(incidence.begin(), incidence.end());
+  std::vector<bool> used(cluster.count, false);
+
+  auto range = [&incidence](unsigned int vertex) {
+    return std::equal_range(
+        incidence.begin(), incidence.end(), std::make_pair(vertex, 0u),
+        [](const std::pair<unsigned int, unsigned int> &a,
+           const std::pair<unsigned int, unsigned int> &b) {
+          return a.first < b.first;
+        });
+  };
+  auto walk = [&](unsigned int vertex, std::vector<unsigned int> &path) {
+    bool extended = true;
+    while (extended) {
+      extended = false;
+      auto [first, last] = range(vertex);
+      for (auto it = first; it != last && !extended; ++it) {
+        if (!used[it->second]) {
+          used[it->second] = extended = true;
+          const Edge_t &edge = local[it->second];
+          vertex = edge.indFirst == vertex ? edge.indSecond : edge.indFirst;
+          path.push_back(vertex);
+        }
+      }
+    }
+  };
+
+  std::vector<std::vector<unsigned int>> strips;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (unsigned int i = 0; i < cluster.count; ++i) {
+      if (used[i]) continue;
+      unsigned int start = local[i].indFirst;
+      unsigned int other = local[i].indSecond;
+      auto [first, last] = range(start);
+      if ((last - first) % 2 == 0) {
+        std::swap(start, other);
+        std::tie(first, last) = range(start);
+      }
+      if (pass == 0 && (last - first) % 2 == 0) continue;
+      std::vector<unsigned int> backward;
+      std::vector<unsigned int> forward = {other};
+      used[i] = true;
+      walk(other, forward);
+      walk(start, backward);
+      std::vector<unsigned int> strip(backward.rbegin(), backward.rend());
+      strip.push_back(start);
+      strip.insert(strip.end(), forward.begin(), forward.end());
+      strips.push_back(std::move(strip));
+    }
+  }
+
+  std::minstd_rand random(static_cast<unsigned int>(index + 1));
+  std::shuffle(strips.begin(), strips.end(), random);
+  for (const std::vector<unsigned int> &strip : strips) {
+    starts.push_back(indices.size());
+    indices.insert(indices.end(), strip.begin(), strip.end());
+    indices.push_back(STRIP_RESTART);
+  }
+}
+
+}  // namespace s21
\ No newline at end of file
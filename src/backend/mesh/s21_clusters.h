@@ -0,0 +1,94 @@
+/// @mainpage
+/// @file s21_clusters.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_CLUSTERS_H
+#define S21_CLUSTERS_H
+
+#include "../../common/s21_parallel.h"
+
+namespace s21 {
+
+/// @brief Желаемое кол-во ребер в одном кластере
+#define CLUSTER_EDGES 4096
+/// @brief Максимальная глубина сетки: 2^5 ячеек по каждой оси
+#define CLUSTER_MAX_LEVEL 5
+/// @brief Индекс-разделитель ломаных для primitive restart
+#define STRIP_RESTART 0xFFFFFFFFu
+
+/// @brief Класс разбиения ребер на пространственные кластеры.
+/// Ребра раскладываются по ячейкам равномерной сетки по середине ребра,
+/// ячейки упорядочены по кривой Мортона, поэтому соседние в пространстве
+/// кластеры чаще всего соседние и в буфере ребер. Ребра каждого кластера
+/// жадно сцепляются в ломаные по общим вершинам, ломаные внутри кластера
+/// перемешаны, поэтому любое начало кластера - равномерная выборка из него.
+class EdgeClusters {
+ public:
+  /// @brief Построение кластеров
+  /// @param vertices Вектор вершин
+  /// @param edges Вектор ребер
+  void build(const std::vector<Vertex_t> &vertices,
+             const std::vector<Edge_t> &edges);
+  /// @brief Очистка кластеров
+  void clear();
+  /// @brief Построены ли кластеры
+  /// @return true, если build вызывался после clear
+  bool isBuilt() const;
+
+  /// @brief Получение ребер, упорядоченных по кластерам
+  /// @return Ссылка на вектор ребер, перестановка исходного
+  const std::vector<Edge_t> &getEdges() const;
+  /// @brief Получение кластеров, пустые ячейки пропущены
+  /// @return Ссылка на вектор кластеров
+  const std::vector<Cluster_t> &getClusters() const;
+  /// @brief Получение индексов ломаных для GL_LINE_STRIP.
+  /// Каждая ломаная завершается индексом STRIP_RESTART.
+  /// @return Ссылка на вектор индексов
+  const std::vector<unsigned int> &getStripIndices() const;
+  /// @brief Получение начал ломаных в векторе индексов
+  /// @return Ссылка на вектор начал, последний элемент - размер индексов
+  const std::vector<std::size_t> &getStripStarts() const;
+
+ private:
+  /// @brief Расчет ячейки для каждого ребра
+  /// @param vertices Вектор вершин
+  /// @param edges Вектор ребер
+  /// @param level Глубина сетки
+  /// @return Номер ячейки по кривой Мортона для каждого ребра
+  static std::vector<unsigned int> cellKeys(
+      const std::vector<Vertex_t> &vertices, const std::vector<Edge_t> &edges,
+      unsigned int level);
+  /// @brief Расчет ограничивающих параллелепипедов кластеров
+  /// @param vertices Вектор вершин
+  void computeBounds(const std::vector<Vertex_t> &vertices);
+  /// @brief Сцепление ребер всех кластеров в ломаные
+  void stripify();
+  /// @brief Сцепление ребер одного кластера в ломаные жадным обходом.
+  /// Обход начинается с вершин нечетной степени и продолжается в обе
+  /// стороны, пока у концов есть неиспользованные ребра.
+  /// @param index Номер кластера
+  /// @param indices Куда записывать индексы ломаных с разделителями
+  /// @param starts Куда записывать начала ломаных относительно indices
+  void stripifyCluster(std::size_t index, std::vector<unsigned int> &indices,
+                       std::vector<std::size_t> &starts) const;
+
+  /// @brief Ребра, упорядоченные по кластерам
+  std::vector<Edge_t> edges;
+  /// @brief Кластеры
+  std::vector<Cluster_t> clusters;
+  /// @brief Индексы ломаных
+  std::vector<unsigned int> stripIndices;
+  /// @brief Начала ломаных
+  std::vector<std::size_t> stripStarts;
+  /// @brief Кластеры построены
+  bool built = false;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
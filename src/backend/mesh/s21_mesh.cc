@@ -0,0 +1,248 @@
+#include "s21_mesh.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Точка проекции грани на плоскость
+using Point2D = std::pair<float, float>;
+
+/// @brief Ориентированная площадь треугольника, умноженная на 2
+float cross(const Point2D &a, const Point2D &b, const Point2D &c) {
+  return (b.first - a.first) * (c.second - a.second) -
+         (b.second - a.second) * (c.first - a.first);
+}
+
+/// @brief Лежит ли точка внутри треугольника против часовой стрелки
+bool isInside(const Point2D &p, const Point2D &a, const Point2D &b,
+              const Point2D &c) {
+  return cross(a, b, p) >= 0 && cross(b, c, p) >= 0 && cross(c, a, p) >= 0;
+}
+
+/// @brief Маска ребер треугольника по позициям его вершин в грани
+unsigned char edgeMask(std::size_t a, std::size_t b, std::size_t c,
+                       std::size_t size) {
+  auto isSide = [size](std::size_t from, std::size_t to) {
+    return (from + 1) % size == to || (to + 1) % size == from;
+  };
+  return (isSide(a, b) ? EDGE_AB : 0) | (isSide(b, c) ? EDGE_BC : 0) |
+         (isSide(c, a) ? EDGE_CA : 0);
+}
+
+}  // namespace
+
+void Mesh::build(const std::vector<Vertex_t> &vertices,
+                 const std::vector<Face_t> &faces) {
+  triangulate(vertices, faces);
+  computeNormals(vertices);
+  built = true;
+}
+
+void Mesh::clear() {
+  triangles.clear();
+  triangles.shrink_to_fit();
+  normals.clear();
+  normals.shrink_to_fit();
+  edgeMasks.clear();
+  edgeMasks.shrink_to_fit();
+  built = false;
+}
+
+bool Mesh::isBuilt() const { return built; }
+
+const std::vector<Triangle_t> &Mesh::getTriangles() const { return triangles; }
+
+const std::vector<Vertex_t> &Mesh::getNormals() const { return normals; }
+
+const std::vector<unsigned char> &Mesh::getEdgeMasks() const {
+  return edgeMasks;
+}
+
+void Mesh::triangulate(const std::vector<Vertex_t> &vertices,
+                       const std::vector<Face_t> &faces) {
+  std::vector<std::size_t> offsets(faces.size());
+  parallelFor(faces.size(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      std::size_t size = faces[i].vertexIndex.size();
+      offsets[i] = size >= 3 ? size - 2 : 0;
+    }
+  });
+  std::size_t total = parallelExclusiveScan(offsets);
+  triangles.assign(total, Triangle_t{0, 0, 0});
+  edgeMasks.assign(total, 0);
+
+  std::size_t count = vertices.size();
+  parallelFor(faces.size(), [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      const std::vector<unsigned int> &index = faces[i].vertexIndex;
+      bool valid = index.size() >= 3;
+      for (std::size_t k = 0; k < index.size() && valid; ++k) {
+        valid = index[k] < count;
+      }
+      if (valid) {
+        triangulateFace(vertices, faces[i], &triangles[offsets[i]],
+                        &edgeMasks[offsets[i]]);
+      }
+    }
+  });
+}
+
+void Mesh::triangulateFace(const std::vector<Vertex_t> &vertices,
+                           const Face_t &face, Triangle_t *out,
+                           unsigned char *masks) {
+  const std::vector<unsigned int> &index = face.vertexIndex;
+  std::size_t size = index.size();
+  if (size == 3) {
+    out[0] = {index[0], index[1], index[2]};
+    masks[0] = EDGE_AB | EDGE_BC | EDGE_CA;
+    return;
+  }
+
+  float normal[3] = {0, 0, 0};
+  for (std::size_t k = 0; k < size; ++k) {
+    const Vertex_t &cur = vertices[index[k]];
+    const Vertex_t &next = vertices[index[(k + 1) % size]];
+    normal[0] += (cur.y - next.y) * (cur.z + next.z);
+    normal[1] += (cur.z - next.z) * (cur.x + next.x);
+    normal[2] += (cur.x - next.x) * (cur.y + next.y);
+  }
+  int axis = 0;
+  for (int k = 1; k < 3; ++k) {
+    if (std::abs(normal[k]) > std::abs(normal[axis])) axis = k;
+  }
+  float sign = normal[axis] < 0 ? -1.0f : 1.0f;
+  auto project = [&](std::size_t k) -> Point2D {
+    const Vertex_t &v = vertices[index[k % size]];
+    if (axis == 0) return {v.y, v.z * sign};
+    if (axis == 1) return {v.z, v.x * sign};
+    return {v.x, v.y * sign};
+  };
+
+  bool convex = true;
+  for (std::size_t k = 0; k < size && convex; ++k) {
+    convex = cross(project(k), project(k + 1), project(k + 2)) >= -MY_EPS;
+  }
+  if (convex) {
+    for (std::size_t k = 1; k + 1 < size; ++k) {
+      out[k - 1] = {index[0], index[k], index[k + 1]};
+      masks[k - 1] = edgeMask(0, k, k + 1, size);
+    }
+  } else {
+    std::vector<Point2D> points(size);
+    for (std::size_t k = 0; k < size; ++k) points[k] = project(k);
+    clipEars(points, face, out, masks);
+  }
+}
+
+void Mesh::clipEars(const std::vector<Point2D> &points, const Face_t &face,
+                    Triangle_t *out, unsigned char *masks) {
+  const std::vector<unsigned int> &index = face.vertexIndex;
+  std::vector<std::size_t> ring(points.size());
+  for (std::size_t k = 0; k < ring.size(); ++k) ring[k] = k;
+  std::size_t written = 0;
+
+  bool clipped = true;
+  while (ring.size() > 3 && clipped) {
+    clipped = false;
+    std::size_t size = ring.size();
+    for (std::size_t k = 0; k < size && !clipped; ++k) {
+      std::size_t prev = ring[(k + size - 1) % size];
+      std::size_t cur = ring[k];
+      std::size_t next = ring[(k + 1) % size];
+      if (cross(points[prev], points[cur], points[next]) > MY_EPS) {
+        bool isEar = true;
+        for (std::size_t other : ring) {
+          if (other != prev && other != cur && other != next &&
+              isInside(points[other], points[prev], points[cur],
+                       points[next])) {
+            isEar = false;
+            break;
+          }
+        }
+        if (isEar) {
+          masks[written] = edgeMask(prev, cur, next, points.size());
+          out[written++] = {index[prev], index[cur], index[next]};
+          ring.erase(ring.begin() + k);
+          clipped = true;
+        }
+      }
+    }
+  }
+  for (std::size_t k = 1; k + 1 < ring.size(); ++k) {
+    masks[written] = edgeMask(ring[0], ring[k], ring[k + 1], points.size());
+    out[written++] = {index[ring[0]], index[ring[k]], index[ring[k + 1]]};
+  }
+}
+
+void Mesh::computeNormals(const std::vector<Vertex_t> &vertices) {
+  std::size_t vertexCount = vertices.size();
+  std::size_t triangleCount = triangles.size();
+
+  std::vector<Vertex_t> faceNormals(triangleCount);
+  parallelFor(triangleCount, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      const Vertex_t &a = vertices[triangles[i].a];
+      const Vertex_t &b = vertices[triangles[i].b];
+      const Vertex_t &c = vertices[triangles[i].c];
+      float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+      float vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+      faceNormals[i] = Vertex_t(uy * vz - uz * vy, uz * vx - ux * vz,
+                                ux * vy - uy * vx);
+    }
+  });
+
+  std::vector<std::atomic<unsigned int>> counters(vertexCount);
+  parallelFor(vertexCount, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      counters[i].store(0, std::memory_order_relaxed);
+    }
+  });
+  parallelFor(triangleCount, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      counters[triangles[i].a].fetch_add(1, std::memory_order_relaxed);
+      counters[triangles[i].b].fetch_add(1, std::memory_order_relaxed);
+      counters[triangles[i].c].fetch_add(1, std::memory_order_relaxed);
+    }
+  });
+
+  std::vector<std::size_t> offsets(vertexCount);
+  parallelFor(vertexCount, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      offsets[i] = counters[i].exchange(0, std::memory_order_relaxed);
+    }
+  });
+  std::size_t total = parallelExclusiveScan(offsets);
+
+  std::vector<unsigned int> adjacency(total);
+  parallelFor(triangleCount, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      for (unsigned int v : {triangles[i].a, triangles[i].b, triangles[i].c}) {
+        std::size_t slot =
+            offsets[v] + counters[v].fetch_add(1, std::memory_order_relaxed);
+        adjacency[slot] = static_cast<unsigned int>(i);
+      }
+    }
+  });
+
+  normals.assign(vertexCount, Vertex_t());
+  parallelFor(vertexCount, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t v = begin; v < end; ++v) {
+      std::size_t first = offsets[v];
+      std::size_t last = v + 1 < vertexCount ? offsets[v + 1] : total;
+      std::sort(adjacency.begin() + first, adjacency.begin() + last);
+      float x = 0, y = 0, z = 0;
+      for (std::size_t k = first; k < last; ++k) {
+        const Vertex_t &n = faceNormals[adjacency[k]];
+        x += n.x;
+        y += n.y;
+        z += n.z;
+      }
+      float length = std::sqrt(x * x + y * y + z * z);
+      normals[v] = length > MY_EPS ? Vertex_t(x / length, y / length,
+                                              z / length)
+                                   : Vertex_t(0, 0, 1);
+    }
+  });
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,91 @@
+/// @mainpage
+/// @file s21_mesh.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_MESH_H
+#define S21_MESH_H
+
+#include "../../common/s21_parallel.h"
+
+namespace s21 {
+
+/// @brief Бит маски: ребро a-b треугольника принадлежит грани
+#define EDGE_AB 1
+/// @brief Бит маски: ребро b-c треугольника принадлежит грани
+#define EDGE_BC 2
+/// @brief Бит маски: ребро c-a треугольника принадлежит грани
+#define EDGE_CA 4
+
+/// @brief Класс поверхности модели: треугольники и нормали вершин.
+/// Выпуклые грани разбиваются веером, невыпуклые - отсечением ушей.
+/// Нормали вершин взвешены по площади прилежащих треугольников.
+/// Оба прохода выполняются параллельно по массивам граней и треугольников.
+class Mesh {
+ public:
+  /// @brief Построение поверхности
+  /// @param vertices Вектор вершин
+  /// @param faces Вектор поверхностей
+  void build(const std::vector<Vertex_t> &vertices,
+             const std::vector<Face_t> &faces);
+  /// @brief Очистка поверхности
+  void clear();
+  /// @brief Построена ли поверхность
+  /// @return true, если build вызывался после clear
+  bool isBuilt() const;
+
+  /// @brief Получение треугольников
+  /// @return Ссылка на вектор треугольников
+  const std::vector<Triangle_t> &getTriangles() const;
+  /// @brief Получение нормалей вершин
+  /// @return Ссылка на вектор нормалей, по одной на вершину
+  const std::vector<Vertex_t> &getNormals() const;
+  /// @brief Получение масок ребер треугольников.
+  /// Диагонали, добавленные при разбиении граней, в маску не входят.
+  /// @return Ссылка на вектор масок из битов EDGE_AB, EDGE_BC, EDGE_CA
+  const std::vector<unsigned char> &getEdgeMasks() const;
+
+ private:
+  /// @brief Разбиение всех граней на треугольники
+  /// @param vertices Вектор вершин
+  /// @param faces Вектор поверхностей
+  void triangulate(const std::vector<Vertex_t> &vertices,
+                   const std::vector<Face_t> &faces);
+  /// @brief Расчет нормалей вершин
+  /// @param vertices Вектор вершин
+  void computeNormals(const std::vector<Vertex_t> &vertices);
+
+  /// @brief Разбиение одной грани на face.size() - 2 треугольника
+  /// @param vertices Вектор вершин
+  /// @param face Грань с корректными индексами
+  /// @param out Куда записывать треугольники
+  /// @param masks Куда записывать маски ребер
+  static void triangulateFace(const std::vector<Vertex_t> &vertices,
+                              const Face_t &face, Triangle_t *out,
+                              unsigned char *masks);
+  /// @brief Разбиение невыпуклой грани отсечением ушей
+  /// @param points Проекция вершин грани на плоскость
+  /// @param face Грань
+  /// @param out Куда записывать треугольники
+  /// @param masks Куда записывать маски ребер
+  static void clipEars(const std::vector<std::pair<float, float>> &points,
+                       const Face_t &face, Triangle_t *out,
+                       unsigned char *masks);
+
+  /// @brief Треугольники поверхности
+  std::vector<Triangle_t> triangles;
+  /// @brief Нормали вершин
+  std::vector<Vertex_t> normals;
+  /// @brief Маски ребер треугольников
+  std::vector<unsigned char> edgeMasks;
+  /// @brief Поверхность построена
+  bool built = false;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "s21_voxel_grid.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Кол-во корзин
+constexpr std::size_t kBuckets = std::size_t(1) << VOXEL_BUCKET_BITS;
+
+/// @brief Номер вокселя координаты по оси
+std::uint64_t voxelIndex(float value, float min, float scale,
+                         unsigned int resolution) {
+  float cell = (value - min) * scale;
+  if (!(cell > 0.0f)) return 0;
+  return std::min(static_cast<unsigned int>(cell), resolution - 1);
+}
+
+/// @brief Корзина вокселя: старшие биты мультипликативного хеша
+std::size_t bucketOf(std::uint64_t key) {
+  return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >>
+                                  (64 - VOXEL_BUCKET_BITS));
+}
+
+}  // namespace
+
+void VoxelGrid::build(const std::vector<Vertex_t> &source,
+                      unsigned int resolution) {
+  clear();
+  built = true;
+  resolution = std::min(resolution, VOXEL_MAX_RESOLUTION);
+  if (source.empty() || resolution == 0) {
+    points = source;
+    return;
+  }
+
+  Bounds_t bounds = parallelBounds(source);
+  float extent = std::max({bounds.max.x - bounds.min.x,
+                           bounds.max.y - bounds.min.y,
+                           bounds.max.z - bounds.min.z});
+  float scale = extent > 0.0f ? resolution / extent : 0.0f;
+  auto keyOf = [&bounds, scale, resolution](const Vertex_t &point) {
+    return (voxelIndex(point.x, bounds.min.x, scale, resolution) << 42) |
+           (voxelIndex(point.y, bounds.min.y, scale, resolution) << 21) |
+           voxelIndex(point.z, bounds.min.z, scale, resolution);
+  };
+
+  std::size_t chunks = parallelWorkers(source.size());
+  std::vector<std::size_t> offsets(kBuckets * chunks, 0);
+  parallelForChunks(source.size(), chunks,
+                    [&source, &offsets, &keyOf, chunks](
+                        std::size_t chunk, std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        ++offsets[bucketOf(keyOf(source[i])) * chunks + chunk];
+                      }
+                    });
+  parallelExclusiveScan(offsets);
+  std::vector<std::size_t> bucketStarts(kBuckets + 1, source.size());
+  for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+    bucketStarts[bucket] = offsets[bucket * chunks];
+  }
+
+  std::vector<unsigned int> order(source.size());
+  parallelForChunks(source.size(), chunks,
+                    [&source, &offsets, &order, &keyOf, chunks](
+                        std::size_t chunk, std::size_t begin, std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        std::size_t bucket = bucketOf(keyOf(source[i]));
+                        order[offsets[bucket * chunks + chunk]++] =
+                            static_cast<unsigned int>(i);
+                      }
+                    });
+
+  std::vector<std::vector<Vertex_t>> voxels(kBuckets);
+  parallelFor(
+      kBuckets,
+      [&](std::size_t begin, std::size_t end) {
+        std::vector<std::pair<std::uint64_t, unsigned int>> entries;
+        for (std::size_t bucket = begin; bucket < end; ++bucket) {
+          entries.clear();
+          for (std::size_t i = bucketStarts[bucket];
+               i < bucketStarts[bucket + 1]; ++i) {
+            entries.emplace_back(keyOf(source[order[i]]), order[i]);
+          }
+          std::sort(entries.begin(), entries.end());
+          for (std::size_t i = 0; i < entries.size();) {
+            double x = 0, y = 0, z = 0;
+            std::size_t j = i;
+            for (; j < entries.size() && entries[j].first == entries[i].first;
+                 ++j) {
+              const Vertex_t &point = source[entries[j].second];
+              x += point.x;
+              y += point.y;
+              z += point.z;
+            }
+            double count = static_cast<double>(j - i);
+            voxels[bucket].push_back({static_cast<float>(x / count),
+                                      static_cast<float>(y / count),
+                                      static_cast<float>(z / count)});
+            i = j;
+          }
+        }
+      },
+      1);
+
+  std::vector<std::size_t> starts(kBuckets, 0);
+  for (std::size_t bucket = 0; bucket < kBuckets; ++bucket) {
+    starts[bucket] = voxels[bucket].size();
+  }
+  points.resize(parallelExclusiveScan(starts));
+  parallelFor(
+      kBuckets,
+      [this, &voxels, &starts](std::size_t begin, std::size_t end) {
+        for (std::size_t bucket = begin; bucket < end; ++bucket) {
+          std::copy(voxels[bucket].begin(), voxels[bucket].end(),
+                    points.begin() + starts[bucket]);
+        }
+      },
+      1);
+}
+
+void VoxelGrid::clear() {
+  points.clear();
+  points.shrink_to_fit();
+  built = false;
+}
+
+bool VoxelGrid::isBuilt() const { return built; }
+
+const std::vector<Vertex_t> &VoxelGrid::getPoints() const { return points; }
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,52 @@
+/// @mainpage
+/// @file s21_voxel_grid.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_VOXEL_GRID_H
+#define S21_VOXEL_GRID_H
+
+#include "../../common/s21_parallel.h"
+
+namespace s21 {
+
+/// @brief Двоичный логарифм кол-ва корзин для группировки точек по вокселям
+#define VOXEL_BUCKET_BITS 10
+/// @brief Максимальное кол-во вокселей по наибольшей оси
+#define VOXEL_MAX_RESOLUTION (1u << 20)
+
+/// @brief Класс прореживания облака точек по воксельной сетке.
+/// Каждый занятый воксель кубической сетки заменяется центром масс
+/// попавших в него точек. Точки раскладываются по корзинам по хешу
+/// вокселя, корзины обрабатываются независимо, поэтому порядок результата
+/// случайный в пространстве и любое его начало - равномерная выборка.
+class VoxelGrid {
+ public:
+  /// @brief Прореживание облака точек
+  /// @param points Вектор точек
+  /// @param resolution Кол-во вокселей по наибольшей оси облака
+  void build(const std::vector<Vertex_t> &points, unsigned int resolution);
+  /// @brief Очистка результата
+  void clear();
+  /// @brief Построен ли результат
+  /// @return true, если build вызывался после clear
+  bool isBuilt() const;
+
+  /// @brief Получение прореженных точек
+  /// @return Ссылка на вектор центров занятых вокселей
+  const std::vector<Vertex_t> &getPoints() const;
+
+ private:
+  /// @brief Прореженные точки
+  std::vector<Vertex_t> points;
+  /// @brief Результат построен
+  bool built = false;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -2,21 +2,112 @@
 
 namespace s21 {
 
-Model &Model::getModel() {
-  static Model instance;
-  return instance;
-}
-
 void Model::clearModel() {
   vertices.clear();
+  vertices.shrink_to_fit();
   faces.clear();
+  faces.shrink_to_fit();
   edges.clear();
+  edges.shrink_to_fit();
+  uniqueEdges.clear();
+  uniqueEdges.shrink_to_fit();
+  faceIndices.clear();
+  faceIndices.shrink_to_fit();
+  faceSizes.clear();
+  faceSizes.shrink_to_fit();
+  bounds = Bounds_t();
+  fileName.clear();
+  vertexCount = faceCount = edgeCount = 0;
+  facesLoaded = edgesBuilt = uniqueEdgesBuilt = boundsBuilt = true;
 }
 
-Status_e Model::readFile(const std::string &FileName) {
-  Status_e status = Status_e::OK;
+Status_e Model::readFile(const std::string &FileName,
+                         const LoadOptions_t &options) {
+  clearModel();
+  fileName = FileName;
+  Status_e status = parseFile(true, options.faces, options.edges);
+  status = vertices.empty() && status == Status_e::OK ? EmptyFile : status;
+  if (status != Status_e::OK) {
+    clearModel();
+  } else {
+    facesLoaded = options.faces;
+    edgesBuilt = options.edges;
+    finishLoading(options);
+  }
+  return status;
+}
+
+void Model::finishLoading(const LoadOptions_t &options) {
+  uniqueEdgesBuilt = boundsBuilt = false;
+  if (options.uniqueEdges) getUniqueEdges();
+  if (options.bounds) getBounds();
+}
+
+bool Model::saveSnapshot(std::FILE *file) {
+  std::uint64_t header[3] = {vertices.size(), faceCount, edgeCount};
+  bool saved = std::fseek(file, 0, SEEK_SET) == 0 &&
+               std::fwrite(header, sizeof(header), 1, file) == 1 &&
+               std::fwrite(vertices.data(), sizeof(Vertex_t),
+                           vertices.size(), file) == vertices.size();
+  if (facesLoaded) {
+    for (std::size_t i = 0; saved && i < faces.size(); ++i) {
+      unsigned size = static_cast<unsigned>(faces[i].vertexIndex.size());
+      saved = std::fwrite(&size, sizeof(size), 1, file) == 1;
+    }
+    for (std::size_t i = 0; saved && i < faces.size(); ++i) {
+      const std::vector<unsigned> &indices = faces[i].vertexIndex;
+      saved = std::fwrite(indices.data(), sizeof(unsigned), indices.size(),
+                          file) == indices.size();
+    }
+  } else {
+    saved = saved &&
+            std::fwrite(faceSizes.data(), sizeof(unsigned), faceSizes.size(),
+                        file) == faceSizes.size() &&
+            std::fwrite(faceIndices.data(), sizeof(unsigned),
+                        faceIndices.size(), file) == faceIndices.size();
+  }
+  return std::fflush(file) == 0 && saved;
+}
+
+Status_e Model::loadSnapshot(std::FILE *file, const LoadOptions_t &options) {
   clearModel();
-  std::ifstream file(FileName);
+  std::uint64_t header[3] = {0, 0, 0};
+  bool loaded = std::fseek(file, 0, SEEK_SET) == 0 &&
+                std::fread(header, sizeof(header), 1, file) == 1;
+  if (loaded) {
+    vertices.resize(header[0]);
+    faceSizes.resize(header[1]);
+    faceIndices.resize(header[2]);
+    loaded = std::fread(vertices.data(), sizeof(Vertex_t), vertices.size(),
+                        file) == vertices.size() &&
+             std::fread(faceSizes.data(), sizeof(unsigned), faceSizes.size(),
+                        file) == faceSizes.size() &&
+             std::fread(faceIndices.data(), sizeof(unsigned),
+                        faceIndices.size(), file) == faceIndices.size();
+  }
+  Status_e status = Status_e::OK;
+  if (!loaded) {
+    clearModel();
+    status = Status_e::ReadError;
+  } else {
+    vertexCount = vertices.size();
+    faceCount = faceSizes.size();
+    edgeCount = faceIndices.size();
+    facesLoaded = edgesBuilt = false;
+    if (options.faces) getFace();
+    if (options.edges) getEdge();
+    finishLoading(options);
+  }
+  return status;
+}
+
+Status_e Model::parseFile(bool withVertices, bool withFaces, bool withEdges) {
+  Status_e status = Status_e::OK;
+  storeVertices = withVertices;
+  storeFaces = withFaces;
+  storeEdges = withEdges;
+  vertexCount = faceCount = edgeCount = 0;
+  std::ifstream file(fileName);
   if (!file.is_open()) {
     status = Status_e::ReadError;
   } else {
@@ -24,12 +115,6 @@ Status_e Model::readFile(const std::string &FileName) {
     while (status == Status_e::OK && std::getline(file, line)) {
       status = readLine(line);
     }
-    status = (vertices.empty() || faces.empty()) && status == Status_e::OK
-                 ? EmptyFile
-                 : status;
-    if (status != Status_e::OK) {
-      clearModel();
-    }
     file.close();
   }
   return status;
@@ -52,7 +137,8 @@ Status_e Model::pushVertex(std::istringstream &iss) {
   Vertex_t vertex;
   Status_e status = Status_e::OK;
   if (iss >> vertex.x >> vertex.y >> vertex.z) {
-    vertices.push_back(vertex);
+    if (storeVertices) vertices.push_back(vertex);
+    ++vertexCount;
   } else {
     status = Status_e::FileCurrupted;
   }
@@ -70,12 +156,12 @@ Status_e Model::pushFace(std::istringstream &iss) {
     try {
       long ind = std::stoi(vertIndex);
       if (ind < 0) {
-        ind += vertices.size();
+        ind += vertexCount;
       } else {
         ind -= 1;
       }
       face.vertexIndex.push_back(unsigned(ind));
-      if (ind > long(vertices.size())) {
+      if (ind > long(vertexCount)) {
         status = Status_e::FileCurrupted;
       }
     } catch (const std::out_of_range &e) {
@@ -86,8 +172,16 @@ Status_e Model::pushFace(std::istringstream &iss) {
     status = Status_e::FileCurrupted;
   }
   if (status == Status_e::OK) {
-    faces.push_back(face);
-    getEdgeFromFace(face);
+    ++faceCount;
+    edgeCount += face.vertexIndex.size();
+    if (storeEdges) getEdgeFromFace(face);
+    if (storeFaces) {
+      faces.push_back(std::move(face));
+    } else {
+      faceIndices.insert(faceIndices.end(), face.vertexIndex.begin(),
+                         face.vertexIndex.end());
+      faceSizes.push_back(static_cast<unsigned>(face.vertexIndex.size()));
+    }
   }
   return status;
 }
@@ -102,8 +196,76 @@ void Model::getEdgeFromFace(const Face_t &face) {
 
 const std::vector<Vertex_t> &Model::getVertex() { return vertices; }
 
-const std::vector<Face_t> &Model::getFace() { return faces; }
+const std::vector<Face_t> &Model::getFace() {
+  if (!facesLoaded) {
+    faces.resize(faceSizes.size());
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < faceSizes.size(); ++i) {
+      faces[i].vertexIndex.assign(faceIndices.begin() + offset,
+                                  faceIndices.begin() + offset + faceSizes[i]);
+      offset += faceSizes[i];
+    }
+    faceIndices.clear();
+    faceIndices.shrink_to_fit();
+    faceSizes.clear();
+    faceSizes.shrink_to_fit();
+    facesLoaded = true;
+  }
+  return faces;
+}
+
+const std::vector<Edge_t> &Model::getEdge() {
+  if (!edgesBuilt) {
+    edges.reserve(edgeCount);
+    if (facesLoaded) {
+      for (const Face_t &face : faces) {
+        getEdgeFromFace(face);
+      }
+    } else {
+      std::size_t offset = 0;
+      for (unsigned size : faceSizes) {
+        for (unsigned i = 0; i < size; ++i) {
+          edges.push_back(Edge_t(faceIndices[offset + i],
+                                 faceIndices[offset + (i + 1) % size]));
+        }
+        offset += size;
+      }
+    }
+    edgesBuilt = true;
+  }
+  return edges;
+}
+
+const std::vector<Edge_t> &Model::getUniqueEdges() {
+  if (!uniqueEdgesBuilt) {
+    uniqueEdges = getEdge();
+    auto less = [](const Edge_t &a, const Edge_t &b) {
+      return a.indFirst < b.indFirst ||
+             (a.indFirst == b.indFirst && a.indSecond < b.indSecond);
+    };
+    auto equal = [](const Edge_t &a, const Edge_t &b) {
+      return a.indFirst == b.indFirst && a.indSecond == b.indSecond;
+    };
+    std::sort(uniqueEdges.begin(), uniqueEdges.end(), less);
+    uniqueEdges.erase(
+        std::unique(uniqueEdges.begin(), uniqueEdges.end(), equal),
+        uniqueEdges.end());
+    uniqueEdges.shrink_to_fit();
+    uniqueEdgesBuilt = true;
+  }
+  return uniqueEdges;
+}
+
+const Bounds_t &Model::getBounds() {
+  if (!boundsBuilt) {
+    if (!vertices.empty()) bounds = parallelBounds(vertices);
+    boundsBuilt = true;
+  }
+  return bounds;
+}
+
+std::size_t Model::getFaceCount() const { return faceCount; }
 
-const std::vector<Edge_t> &Model::getEdge() { return edges; }
+std::size_t Model::getEdgeCount() const { return edgeCount; }
 
 }  // namespace s21
\ No newline at end of file
@@ -10,38 +10,17 @@
 #ifndef S21_MODEL_H
 #define S21_MODEL_H
 
-#include "../../common/s21_common.h"
+#include "../../common/s21_parallel.h"
 
 namespace s21 {
 
-/// @brief Класс синглтона модели
+/// @brief Класс модели. Каждый бэкенд владеет своей моделью, поэтому
+/// контроллеры разных потоков не делят геометрию
 class Model {
  public:
-  /// @brief Доступ к синглтону модели
-  /// @return Возвращает ссылку на синглтон
-  static Model &getModel();
-  /// @brief Очищает модель
-  void clearModel();
-
-  /// @brief Считывание файла
-  /// @param FileName Путь до файла
-  /// @return Взвращает статус выполнения чтения файла
-  Status_e readFile(const std::string &FileName);
-
-  /// @brief Получение вектора точек
-  /// @return Возвращает ссылку на вектор точек модели
-  const std::vector<Vertex_t> &getVertex();
-  /// @brief Получение вектора поверхностей
-  /// @return Возвращает ссылку на вектор поверхностей
-  const std::vector<Face_t> &getFace();
-  /// @brief Получение вектора ребер
-  /// @return Возвращает ссылку на вектор ребер
-  const std::vector<Edge_t> &getEdge();
-
- protected:
-  /// @brief Стандартный конструктор, к нему нет доступа
+  /// @brief Стандартный конструктор
   Model() = default;
-  /// @brief Деструктор, к нему нет доступа
+  /// @brief Стандартный деструктор
   ~Model() = default;
 
   /// @brief Удаление конструктора копирования
@@ -55,6 +34,64 @@ class Model {
   /// @return Нет возвращения
   Model &operator=(const Model &) = delete;
 
+  /// @brief Очищает модель и освобождает память
+  void clearModel();
+
+  /// @brief Считывание файла. Файл только с вершинами читается как облако
+  /// точек, пустым считается файл без вершин. Поверхности проверяются всегда,
+  /// но сохраняются только выбранные в options структуры
+  /// @param FileName Путь до файла
+  /// @param options Что построить сразу
+  /// @return Взвращает статус выполнения чтения файла
+  Status_e readFile(const std::string &FileName,
+                    const LoadOptions_t &options = LoadOptions_t());
+  /// @brief Запись вершин и индексов поверхностей в двоичный файл, из
+  /// которого модель восстанавливается без разбора текста OBJ
+  /// @param file Открытый на запись и чтение файл
+  /// @return true, если снимок записан целиком
+  bool saveSnapshot(std::FILE *file);
+  /// @brief Чтение модели из снимка saveSnapshot
+  /// @param file Файл со снимком
+  /// @param options Что построить сразу
+  /// @return ReadError, если снимок не прочитан целиком
+  Status_e loadSnapshot(std::FILE *file,
+                        const LoadOptions_t &options = LoadOptions_t());
+
+  /// @brief Получение вектора точек
+  /// @return Возвращает ссылку на вектор точек модели
+  const std::vector<Vertex_t> &getVertex();
+  /// @brief Получение вектора поверхностей, если они не сохранены при
+  /// чтении - строятся из индексов, сохраненных при чтении файла
+  /// @return Возвращает ссылку на вектор поверхностей
+  const std::vector<Face_t> &getFace();
+  /// @brief Получение вектора ребер, строится при первом запросе
+  /// @return Возвращает ссылку на вектор ребер
+  const std::vector<Edge_t> &getEdge();
+  /// @brief Получение уникальных ребер, строятся при первом запросе
+  /// @return Возвращает ссылку на вектор ребер, упорядоченных по вершинам
+  const std::vector<Edge_t> &getUniqueEdges();
+  /// @brief Получение ограничивающего параллелепипеда, считается при первом
+  /// запросе
+  /// @return Возвращает ссылку на параллелепипед
+  const Bounds_t &getBounds();
+  /// @brief Кол-во поверхностей без их построения
+  /// @return Кол-во поверхностей файла
+  std::size_t getFaceCount() const;
+  /// @brief Кол-во ребер без их построения
+  /// @return Кол-во ребер файла, общие ребра учитываются дважды
+  std::size_t getEdgeCount() const;
+
+ protected:
+  /// @brief Проход по файлу с сохранением выбранных структур
+  /// @param withVertices Сохранять вершины
+  /// @param withFaces Сохранять поверхности
+  /// @param withEdges Сохранять ребра
+  /// @return Статус прочтения файла
+  Status_e parseFile(bool withVertices, bool withFaces, bool withEdges);
+  /// @brief Отметка структур, не построенных при чтении, и построение
+  /// выбранных в options
+  /// @param options Что построить сразу
+  void finishLoading(const LoadOptions_t &options);
   /// @brief Чтение строки из файла
   /// @param line Строка файла
   /// @return Статус прочтения строки
@@ -79,6 +116,38 @@ class Model {
   std::vector<Face_t> faces;
   /// @brief Вектор ребер
   std::vector<Edge_t> edges;
+  /// @brief Вектор уникальных ребер
+  std::vector<Edge_t> uniqueEdges;
+  /// @brief Индексы вершин поверхностей подряд, пока поверхности не
+  /// построены. Файл не перечитывается, поэтому поверхности и ребра всегда
+  /// соответствуют вершинам в памяти
+  std::vector<unsigned> faceIndices;
+  /// @brief Кол-во вершин каждой поверхности в faceIndices
+  std::vector<unsigned> faceSizes;
+  /// @brief Ограничивающий параллелепипед
+  Bounds_t bounds;
+  /// @brief Путь до файла модели
+  std::string fileName;
+  /// @brief Кол-во вершин, прочитанных в текущем проходе
+  std::size_t vertexCount = 0;
+  /// @brief Кол-во поверхностей файла
+  std::size_t faceCount = 0;
+  /// @brief Кол-во ребер файла
+  std::size_t edgeCount = 0;
+  /// @brief Сохранять вершины в текущем проходе
+  bool storeVertices = true;
+  /// @brief Сохранять поверхности в текущем проходе
+  bool storeFaces = true;
+  /// @brief Сохранять ребра в текущем проходе
+  bool storeEdges = true;
+  /// @brief Поверхности прочитаны
+  bool facesLoaded = true;
+  /// @brief Ребра построены
+  bool edgesBuilt = true;
+  /// @brief Уникальные ребра построены
+  bool uniqueEdgesBuilt = true;
+  /// @brief Параллелепипед посчитан
+  bool boundsBuilt = true;
 };
 
 }  // namespace s21
@@ -0,0 +1,431 @@
+#include "s21_software_renderer.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Минимальное W вершины перед делением
+constexpr float kMinW = 1e-6f;
+
+/// @brief Произведение матриц 4x4 по строкам
+/// @param a Левая матрица
+/// @param b Правая матрица
+/// @param result Результат, не совпадает с a и b
+void multiply(const float a[16], const float b[16], float result[16]) {
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      float sum = 0.0f;
+      for (int k = 0; k < 4; ++k) sum += a[row * 4 + k] * b[k * 4 + col];
+      result[row * 4 + col] = sum;
+    }
+  }
+}
+
+/// @brief Отсечение отрезка прямоугольником (Liang-Barsky)
+/// @param x0 Начало по X
+/// @param y0 Начало по Y
+/// @param dx Приращение по X
+/// @param dy Приращение по Y
+/// @param box Прямоугольник: минимум X, минимум Y, максимум X, максимум Y
+/// @param t0 Начальный параметр, сужается
+/// @param t1 Конечный параметр, сужается
+/// @return false, если отрезок вне прямоугольника
+bool clipRect(float x0, float y0, float dx, float dy, const float box[4],
+              float &t0, float &t1) {
+  const float p[4] = {-dx, -dy, dx, dy};
+  const float q[4] = {x0 - box[0], y0 - box[1], box[2] - x0, box[3] - y0};
+  for (int i = 0; i < 4; ++i) {
+    if (p[i] == 0.0f) {
+      if (q[i] < 0.0f) return false;
+    } else {
+      float t = q[i] / p[i];
+      if (p[i] < 0.0f) {
+        t0 = std::max(t0, t);
+      } else {
+        t1 = std::min(t1, t);
+      }
+    }
+  }
+  return t0 <= t1;
+}
+
+}  // namespace
+
+void SoftwareRenderer::mvpMatrix(const Matrix &model, float aspect,
+                                 bool isOrtho, float mvp[16]) {
+  const float nearPlane = 0.1f;
+  const float farPlane = 100.0f;
+  float projection[16] = {};
+  if (isOrtho) {
+    projection[0] = 1.0f / aspect;
+    projection[5] = 1.0f;
+    projection[10] = -2.0f / 101.0f;
+    projection[11] = -99.0f / 101.0f;
+    projection[15] = 1.0f;
+  } else {
+    float top = static_cast<float>(std::tan(45.0 * M_PI / 360.0)) * nearPlane;
+    projection[0] = nearPlane / (top * aspect);
+    projection[5] = nearPlane / top;
+    projection[10] = -(farPlane + nearPlane) / (farPlane - nearPlane);
+    projection[11] = -2.0f * farPlane * nearPlane / (farPlane - nearPlane);
+    projection[14] = -1.0f;
+  }
+  const float camera[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, -2, 0, 0, 0, 1};
+  float transformation[16];
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      transformation[row * 4 + col] = model[row][col];
+    }
+  }
+  float view[16];
+  multiply(projection, camera, view);
+  multiply(view, transformation, mvp);
+}
+
+void SoftwareRenderer::resize(int newWidth, int newHeight) {
+  width = std::max(1, newWidth);
+  height = std::max(1, newHeight);
+  tilesX = (width + RASTER_TILE - 1) / RASTER_TILE;
+  tilesY = (height + RASTER_TILE - 1) / RASTER_TILE;
+  std::size_t area = static_cast<std::size_t>(width) * height;
+  pixels.assign(area * 3, 0);
+  depth.assign(area, 1.0f);
+}
+
+void SoftwareRenderer::render(const std::vector<Vertex_t> &vertices,
+                              const std::vector<unsigned int> &strips,
+                              const Matrix &model,
+                              const RasterSettings_t &settings) {
+  float mvp[16];
+  mvpMatrix(model, static_cast<float>(width) / height, settings.isOrtho, mvp);
+  transformVertices(vertices, mvp);
+  setupEdges(strips, settings.lineWidth);
+  setupPoints(settings.pointSize);
+
+  std::size_t tiles = static_cast<std::size_t>(tilesX) * tilesY;
+  std::size_t workers = parallelWorkers(tiles, 1);
+  parallelForChunks(workers, workers,
+                    [this, tiles, workers, &settings](
+                        std::size_t chunk, std::size_t, std::size_t) {
+                      for (std::size_t tile = chunk; tile < tiles;
+                           tile += workers) {
+                        rasterizeTile(tile, settings);
+                      }
+                    });
+}
+
+int SoftwareRenderer::getWidth() const { return width; }
+
+int SoftwareRenderer::getHeight() const { return height; }
+
+const std::vector<std::uint8_t> &SoftwareRenderer::getPixels() const {
+  return pixels;
+}
+
+std::size_t SoftwareRenderer::getEdgeCount() const { return edgeCount; }
+
+void SoftwareRenderer::transformVertices(const std::vector<Vertex_t> &vertices,
+                                         const float m[16]) {
+  std::size_t count = vertices.size();
+  for (std::vector<float> *values :
+       {&clipX, &clipY, &clipZ, &clipW, &screenX, &screenY, &screenZ}) {
+    values->resize(count);
+  }
+  inside.resize(count);
+  float halfWidth = width * 0.5f;
+  float halfHeight = height * 0.5f;
+  parallelFor(count, [&](std::size_t begin, std::size_t end) {
+    float *cx = clipX.data();
+    float *cy = clipY.data();
+    float *cz = clipZ.data();
+    float *cw = clipW.data();
+    for (std::size_t i = begin; i < end; ++i) {
+      float x = vertices[i].x;
+      float y = vertices[i].y;
+      float z = vertices[i].z;
+      cx[i] = m[0] * x + m[1] * y + m[2] * z + m[3];
+      cy[i] = m[4] * x + m[5] * y + m[6] * z + m[7];
+      cz[i] = m[8] * x + m[9] * y + m[10] * z + m[11];
+      cw[i] = m[12] * x + m[13] * y + m[14] * z + m[15];
+    }
+    float *sx = screenX.data();
+    float *sy = screenY.data();
+    float *sz = screenZ.data();
+    std::uint8_t *in = inside.data();
+    for (std::size_t i = begin; i < end; ++i) {
+      float w = std::max(cw[i], kMinW);
+      float inverse = 1.0f / w;
+      sx[i] = (cx[i] * inverse + 1.0f) * halfWidth;
+      sy[i] = (1.0f - cy[i] * inverse) * halfHeight;
+      sz[i] = cz[i] * inverse * 0.5f + 0.5f;
+      in[i] = (cz[i] + cw[i] >= 0.0f) & (cw[i] - cz[i] >= 0.0f) &
+              (cw[i] > kMinW);
+    }
+  });
+}
+
+void SoftwareRenderer::setupEdges(const std::vector<unsigned int> &strips,
+                                  float lineWidth) {
+  std::size_t count = lineWidth > 0.0f && strips.size() > 1
+                          ? strips.size() - 1
+                          : 0;
+  std::size_t chunks = parallelWorkers(count, RASTER_GRAIN);
+  std::size_t tiles = static_cast<std::size_t>(tilesX) * tilesY;
+  segments.resize(chunks);
+  edgeBins.resize(chunks);
+  std::vector<std::size_t> counts(chunks, 0);
+  float halfWidth = std::max(1.0f, std::round(lineWidth)) * 0.5f;
+  const float box[4] = {-halfWidth, -halfWidth, width + halfWidth,
+                        height + halfWidth};
+  std::size_t vertices = inside.size();
+  parallelForChunks(count, chunks, [&](std::size_t chunk, std::size_t begin,
+                                       std::size_t end) {
+    segments[chunk].clear();
+    edgeBins[chunk].resize(tiles);
+    for (std::vector<std::uint32_t> &bin : edgeBins[chunk]) bin.clear();
+    for (std::size_t i = begin; i < end; ++i) {
+      unsigned int a = strips[i];
+      unsigned int b = strips[i + 1];
+      if (a >= vertices || b >= vertices) continue;
+      Segment_t segment{};
+      if (inside[a] && inside[b]) {
+        segment = {screenX[a], screenY[a], screenZ[a],
+                   screenX[b], screenY[b], screenZ[b]};
+      } else if (!clipEdge(a, b, segment)) {
+        continue;
+      }
+      float dx = segment.x1 - segment.x0;
+      float dy = segment.y1 - segment.y0;
+      float t0 = 0.0f;
+      float t1 = 1.0f;
+      if (!clipRect(segment.x0, segment.y0, dx, dy, box, t0, t1)) continue;
+      float dz = segment.z1 - segment.z0;
+      segment = {segment.x0 + t0 * dx, segment.y0 + t0 * dy,
+                 segment.z0 + t0 * dz, segment.x0 + t1 * dx,
+                 segment.y0 + t1 * dy, segment.z0 + t1 * dz};
+      segments[chunk].push_back(segment);
+      binSegment(chunk, segment, halfWidth);
+      ++counts[chunk];
+    }
+  });
+  edgeCount = 0;
+  for (std::size_t value : counts) edgeCount += value;
+}
+
+void SoftwareRenderer::setupPoints(float pointSize) {
+  std::size_t count = pointSize > 0.0f ? inside.size() : 0;
+  std::size_t chunks = parallelWorkers(count, RASTER_GRAIN);
+  std::size_t tiles = static_cast<std::size_t>(tilesX) * tilesY;
+  pointBins.resize(chunks);
+  float halfSize = std::max(1.0f, pointSize) * 0.5f;
+  parallelForChunks(count, chunks, [&](std::size_t chunk, std::size_t begin,
+                                       std::size_t end) {
+    pointBins[chunk].resize(tiles);
+    for (std::vector<std::uint32_t> &bin : pointBins[chunk]) bin.clear();
+    for (std::size_t i = begin; i < end; ++i) {
+      if (!inside[i]) continue;
+      float x0 = screenX[i] - halfSize;
+      float x1 = screenX[i] + halfSize;
+      float y0 = screenY[i] - halfSize;
+      float y1 = screenY[i] + halfSize;
+      if (x1 < 0.0f || y1 < 0.0f || x0 > width || y0 > height) continue;
+      int tx0 = std::clamp(static_cast<int>(x0) / RASTER_TILE, 0, tilesX - 1);
+      int tx1 = std::clamp(static_cast<int>(x1) / RASTER_TILE, 0, tilesX - 1);
+      int ty0 = std::clamp(static_cast<int>(y0) / RASTER_TILE, 0, tilesY - 1);
+      int ty1 = std::clamp(static_cast<int>(y1) / RASTER_TILE, 0, tilesY - 1);
+      for (int ty = ty0; ty <= ty1; ++ty) {
+        for (int tx = tx0; tx <= tx1; ++tx) {
+          pointBins[chunk][ty * tilesX + tx].push_back(
+              static_cast<std::uint32_t>(i));
+        }
+      }
+    }
+  });
+}
+
+bool SoftwareRenderer::clipEdge(unsigned int a, unsigned int b,
+                                Segment_t &segment) const {
+  const float planesA[2] = {clipZ[a] + clipW[a], clipW[a] - clipZ[a]};
+  const float planesB[2] = {clipZ[b] + clipW[b], clipW[b] - clipZ[b]};
+  float t0 = 0.0f;
+  float t1 = 1.0f;
+  for (int i = 0; i < 2; ++i) {
+    if (planesA[i] < 0.0f && planesB[i] < 0.0f) return false;
+    if (planesA[i] < 0.0f) {
+      t0 = std::max(t0, planesA[i] / (planesA[i] - planesB[i]));
+    } else if (planesB[i] < 0.0f) {
+      t1 = std::min(t1, planesA[i] / (planesA[i] - planesB[i]));
+    }
+  }
+  if (t0 > t1) return false;
+  float ends[2][3];
+  const float parameters[2] = {t0, t1};
+  for (int end = 0; end < 2; ++end) {
+    float t = parameters[end];
+    float x = clipX[a] + t * (clipX[b] - clipX[a]);
+    float y = clipY[a] + t * (clipY[b] - clipY[a]);
+    float z = clipZ[a] + t * (clipZ[b] - clipZ[a]);
+    float w = clipW[a] + t * (clipW[b] - clipW[a]);
+    if (w <= kMinW) return false;
+    ends[end][0] = (x / w + 1.0f) * width * 0.5f;
+    ends[end][1] = (1.0f - y / w) * height * 0.5f;
+    ends[end][2] = z / w * 0.5f + 0.5f;
+  }
+  segment = {ends[0][0], ends[0][1], ends[0][2],
+             ends[1][0], ends[1][1], ends[1][2]};
+  return true;
+}
+
+void SoftwareRenderer::binSegment(std::size_t chunk, const Segment_t &segment,
+                                  float halfWidth) {
+  std::uint32_t index =
+      static_cast<std::uint32_t>(segments[chunk].size() - 1);
+  float dx = segment.x1 - segment.x0;
+  float dy = segment.y1 - segment.y0;
+  float margin = halfWidth + 1.0f;
+  float minY = std::min(segment.y0, segment.y1) - margin;
+  float maxY = std::max(segment.y0, segment.y1) + margin;
+  int ty0 = std::clamp(static_cast<int>(std::floor(minY / RASTER_TILE)), 0,
+                       tilesY - 1);
+  int ty1 = std::clamp(static_cast<int>(std::floor(maxY / RASTER_TILE)), 0,
+                       tilesY - 1);
+  if (ty0 == ty1) {
+    float minX = std::min(segment.x0, segment.x1) - margin;
+    float maxX = std::max(segment.x0, segment.x1) + margin;
+    int tx0 = std::clamp(static_cast<int>(std::floor(minX / RASTER_TILE)), 0,
+                         tilesX - 1);
+    int tx1 = std::clamp(static_cast<int>(std::floor(maxX / RASTER_TILE)), 0,
+                         tilesX - 1);
+    for (int tx = tx0; tx <= tx1; ++tx) {
+      edgeBins[chunk][ty0 * tilesX + tx].push_back(index);
+    }
+    return;
+  }
+  for (int ty = ty0; ty <= ty1; ++ty) {
+    float x0 = std::min(segment.x0, segment.x1);
+    float x1 = std::max(segment.x0, segment.x1);
+    if (std::abs(dy) > 1e-6f) {
+      float low = (ty * RASTER_TILE - margin - segment.y0) / dy;
+      float high = ((ty + 1) * RASTER_TILE + margin - segment.y0) / dy;
+      float t0 = std::max(0.0f, std::min(low, high));
+      float t1 = std::min(1.0f, std::max(low, high));
+      if (t0 > t1) continue;
+      x0 = std::min(segment.x0 + t0 * dx, segment.x0 + t1 * dx);
+      x1 = std::max(segment.x0 + t0 * dx, segment.x0 + t1 * dx);
+    }
+    int tx0 = std::clamp(
+        static_cast<int>(std::floor((x0 - margin) / RASTER_TILE)), 0,
+        tilesX - 1);
+    int tx1 = std::clamp(
+        static_cast<int>(std::floor((x1 + margin) / RASTER_TILE)), 0,
+        tilesX - 1);
+    for (int tx = tx0; tx <= tx1; ++tx) {
+      edgeBins[chunk][ty * tilesX + tx].push_back(index);
+    }
+  }
+}
+
+void SoftwareRenderer::rasterizeTile(std::size_t tile,
+                                     const RasterSettings_t &settings) {
+  int tx = static_cast<int>(tile % tilesX);
+  int ty = static_cast<int>(tile / tilesX);
+  const int rect[4] = {tx * RASTER_TILE, ty * RASTER_TILE,
+                       std::min(width, (tx + 1) * RASTER_TILE),
+                       std::min(height, (ty + 1) * RASTER_TILE)};
+  for (int y = rect[1]; y < rect[3]; ++y) {
+    std::size_t row = static_cast<std::size_t>(y) * width;
+    std::fill(depth.begin() + row + rect[0], depth.begin() + row + rect[2],
+              1.0f);
+    for (int x = rect[0]; x < rect[2]; ++x) {
+      std::memcpy(&pixels[(row + x) * 3], settings.background, 3);
+    }
+  }
+  int thickness =
+      std::max(1, static_cast<int>(std::lround(settings.lineWidth)));
+  for (std::size_t chunk = 0; chunk < edgeBins.size(); ++chunk) {
+    if (edgeBins[chunk].size() <= tile) continue;
+    for (std::uint32_t index : edgeBins[chunk][tile]) {
+      drawSegment(segments[chunk][index], rect, thickness,
+                  settings.edgeColor);
+    }
+  }
+  for (std::size_t chunk = 0; chunk < pointBins.size(); ++chunk) {
+    if (pointBins[chunk].size() <= tile) continue;
+    for (std::uint32_t index : pointBins[chunk][tile]) {
+      drawPoint(index, rect, std::max(1.0f, settings.pointSize),
+                settings.roundPoints, settings.vertexColor);
+    }
+  }
+}
+
+void SoftwareRenderer::drawSegment(const Segment_t &segment, const int rect[4],
+                                   int thickness,
+                                   const std::uint8_t color[3]) {
+  float dx = segment.x1 - segment.x0;
+  float dy = segment.y1 - segment.y0;
+  float dz = segment.z1 - segment.z0;
+  bool xMajor = std::abs(dx) >= std::abs(dy);
+  float major0 = xMajor ? segment.x0 : segment.y0;
+  float majorDelta = xMajor ? dx : dy;
+  float minor0 = xMajor ? segment.y0 : segment.x0;
+  float minorDelta = xMajor ? dy : dx;
+  if (majorDelta == 0.0f) return;
+  int majorLow = xMajor ? rect[0] : rect[1];
+  int majorHigh = xMajor ? rect[2] : rect[3];
+  int minorLow = xMajor ? rect[1] : rect[0];
+  int minorHigh = xMajor ? rect[3] : rect[2];
+  float from = std::min(major0, major0 + majorDelta);
+  float to = std::max(major0, major0 + majorDelta);
+  int first = std::max(majorLow, static_cast<int>(std::ceil(from - 0.5f)));
+  int last = std::min(majorHigh, static_cast<int>(std::ceil(to - 0.5f)));
+  float inverse = 1.0f / majorDelta;
+  int offset = (thickness - 1) / 2;
+  for (int major = first; major < last; ++major) {
+    float t = (major + 0.5f - major0) * inverse;
+    int minor = static_cast<int>(std::floor(minor0 + t * minorDelta)) - offset;
+    int begin = std::max(minor, minorLow);
+    int end = std::min(minor + thickness, minorHigh);
+    float z = segment.z0 + t * dz;
+    for (int m = begin; m < end; ++m) {
+      if (xMajor) {
+        plot(major, m, z, color);
+      } else {
+        plot(m, major, z, color);
+      }
+    }
+  }
+}
+
+void SoftwareRenderer::drawPoint(std::size_t index, const int rect[4],
+                                 float size, bool round,
+                                 const std::uint8_t color[3]) {
+  float half = size * 0.5f;
+  float cx = screenX[index];
+  float cy = screenY[index];
+  int x0 = std::max(rect[0], static_cast<int>(std::ceil(cx - half - 0.5f)));
+  int x1 =
+      std::min(rect[2] - 1, static_cast<int>(std::floor(cx + half - 0.5f)));
+  int y0 = std::max(rect[1], static_cast<int>(std::ceil(cy - half - 0.5f)));
+  int y1 =
+      std::min(rect[3] - 1, static_cast<int>(std::floor(cy + half - 0.5f)));
+  for (int y = y0; y <= y1; ++y) {
+    float ry = y + 0.5f - cy;
+    for (int x = x0; x <= x1; ++x) {
+      float rx = x + 0.5f - cx;
+      if (!round || rx * rx + ry * ry <= half * half) {
+        plot(x, y, screenZ[index], color);
+      }
+    }
+  }
+}
+
+void SoftwareRenderer::plot(int x, int y, float z,
+                            const std::uint8_t color[3]) {
+  std::size_t index = static_cast<std::size_t>(y) * width + x;
+  if (z <= depth[index]) {
+    depth[index] = z;
+    std::memcpy(&pixels[index * 3], color, 3);
+  }
+}
+
+}  // namespace s21
\ No newline at end of file
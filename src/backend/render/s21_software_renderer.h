@@ -0,0 +1,193 @@
+/// @mainpage
+/// @file s21_software_renderer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_SOFTWARE_RENDERER_H
+#define S21_SOFTWARE_RENDERER_H
+
+#include "../../common/s21_parallel.h"
+#include "../matrix/s21_matrix.h"
+#include "../mesh/s21_clusters.h"
+
+/// @brief Сторона экранной плитки в пикселях
+#define RASTER_TILE 64
+/// @brief Минимум ребер на поток подготовки
+#define RASTER_GRAIN 8192
+
+namespace s21 {
+
+/// @brief Настройки программной отрисовки
+struct RasterSettings_t {
+  /// @brief Ортогональная проекция
+  bool isOrtho = true;
+  /// @brief Цвет фона RGB
+  std::uint8_t background[3] = {0, 0, 0};
+  /// @brief Цвет ребер RGB
+  std::uint8_t edgeColor[3] = {255, 255, 255};
+  /// @brief Цвет вершин RGB
+  std::uint8_t vertexColor[3] = {255, 255, 255};
+  /// @brief Толщина ребер в пикселях, 0 - ребра не рисуются
+  float lineWidth = 1.0f;
+  /// @brief Размер вершин в пикселях, 0 - вершины не рисуются
+  float pointSize = 0.0f;
+  /// @brief Круглые вершины, иначе квадратные
+  bool roundPoints = true;
+};
+
+/// @brief Программная многопоточная отрисовка каркаса без openGL.
+/// Вершины переводятся в пространство отсечения той же матрицей MVP, что и
+/// в Renderer, одним проходом по массивам координат, который компилятор
+/// векторизует. Ребра ломаных отсекаются по ближней и дальней плоскостям,
+/// переводятся в экранные отрезки и раскладываются по плиткам, которые
+/// пересекают. Плитки рисуются параллельно с тестом глубины, каждая пишет
+/// только в свои пиксели, поэтому синхронизация не нужна.
+class SoftwareRenderer {
+ public:
+  /// @brief Матрица MVP как в Renderer::updateTransformation: проекция,
+  /// сдвиг камеры на -2 по Z и трансформация модели
+  /// @param model Матрица трансформаций модели 4x4
+  /// @param aspect Отношение ширины к высоте
+  /// @param isOrtho Ортогональная проекция
+  /// @param mvp Матрица 4x4 по строкам
+  static void mvpMatrix(const Matrix &model, float aspect, bool isOrtho,
+                        float mvp[16]);
+
+  /// @brief Изменение размера изображения
+  /// @param width Ширина в пикселях
+  /// @param height Высота в пикселях
+  void resize(int width, int height);
+  /// @brief Отрисовка кадра
+  /// @param vertices Вершины модели
+  /// @param strips Индексы ломаных ребер, разделенные STRIP_RESTART
+  /// @param model Матрица трансформаций модели 4x4
+  /// @param settings Настройки отрисовки
+  void render(const std::vector<Vertex_t> &vertices,
+              const std::vector<unsigned int> &strips, const Matrix &model,
+              const RasterSettings_t &settings);
+
+  /// @brief Ширина изображения
+  /// @return Ширина в пикселях
+  int getWidth() const;
+  /// @brief Высота изображения
+  /// @return Высота в пикселях
+  int getHeight() const;
+  /// @brief Пиксели RGB, строки сверху вниз без выравнивания
+  /// @return Ссылка на вектор пикселей
+  const std::vector<std::uint8_t> &getPixels() const;
+  /// @brief Кол-во ребер, попавших в кадр при последней отрисовке
+  /// @return Кол-во ребер
+  std::size_t getEdgeCount() const;
+
+ private:
+  /// @brief Экранный отрезок
+  struct Segment_t {
+    /// @brief Начало по X
+    float x0;
+    /// @brief Начало по Y
+    float y0;
+    /// @brief Глубина начала
+    float z0;
+    /// @brief Конец по X
+    float x1;
+    /// @brief Конец по Y
+    float y1;
+    /// @brief Глубина конца
+    float z1;
+  };
+
+  /// @brief Перевод вершин в пространство отсечения и на экран
+  /// @param vertices Вершины модели
+  /// @param mvp Матрица 4x4 по строкам
+  void transformVertices(const std::vector<Vertex_t> &vertices,
+                         const float mvp[16]);
+  /// @brief Подготовка ребер и раскладка по плиткам
+  /// @param strips Индексы ломаных ребер
+  /// @param lineWidth Толщина ребер, 0 - ребра не рисуются
+  void setupEdges(const std::vector<unsigned int> &strips, float lineWidth);
+  /// @brief Раскладка вершин по плиткам
+  /// @param pointSize Размер вершин, 0 - вершины не рисуются
+  void setupPoints(float pointSize);
+  /// @brief Перевод ребра, пересекающего ближнюю или дальнюю плоскость
+  /// @param a Индекс начала
+  /// @param b Индекс конца
+  /// @param segment Отрезок на экране
+  /// @return false, если ребро целиком вне отсекающих плоскостей
+  bool clipEdge(unsigned int a, unsigned int b, Segment_t &segment) const;
+  /// @brief Добавление отрезка в плитки, которые он пересекает
+  /// @param chunk Номер потока подготовки
+  /// @param segment Отрезок
+  /// @param halfWidth Половина толщины ребра
+  void binSegment(std::size_t chunk, const Segment_t &segment,
+                  float halfWidth);
+  /// @brief Отрисовка плитки
+  /// @param tile Номер плитки
+  /// @param settings Настройки отрисовки
+  void rasterizeTile(std::size_t tile, const RasterSettings_t &settings);
+  /// @brief Отрисовка части отрезка внутри плитки
+  /// @param segment Отрезок
+  /// @param rect Плитка: x0, y0, x1, y1, правая и нижняя границы не входят
+  /// @param thickness Толщина в пикселях
+  /// @param color Цвет
+  void drawSegment(const Segment_t &segment, const int rect[4], int thickness,
+                   const std::uint8_t color[3]);
+  /// @brief Отрисовка части вершины внутри плитки
+  /// @param index Индекс вершины
+  /// @param rect Плитка: x0, y0, x1, y1, правая и нижняя границы не входят
+  /// @param size Размер в пикселях
+  /// @param round Круглая вершина
+  /// @param color Цвет
+  void drawPoint(std::size_t index, const int rect[4], float size, bool round,
+                 const std::uint8_t color[3]);
+  /// @brief Запись пикселя с тестом глубины
+  /// @param x Столбец
+  /// @param y Строка
+  /// @param z Глубина
+  /// @param color Цвет
+  void plot(int x, int y, float z, const std::uint8_t color[3]);
+
+  /// @brief Ширина изображения
+  int width = 1;
+  /// @brief Высота изображения
+  int height = 1;
+  /// @brief Кол-во плиток по X
+  int tilesX = 1;
+  /// @brief Кол-во плиток по Y
+  int tilesY = 1;
+  /// @brief Пиксели RGB
+  std::vector<std::uint8_t> pixels = std::vector<std::uint8_t>(3, 0);
+  /// @brief Буфер глубины
+  std::vector<float> depth = std::vector<float>(1, 1.0f);
+  /// @brief Координаты X вершин в пространстве отсечения
+  std::vector<float> clipX;
+  /// @brief Координаты Y вершин в пространстве отсечения
+  std::vector<float> clipY;
+  /// @brief Координаты Z вершин в пространстве отсечения
+  std::vector<float> clipZ;
+  /// @brief Координаты W вершин в пространстве отсечения
+  std::vector<float> clipW;
+  /// @brief Экранные координаты X вершин
+  std::vector<float> screenX;
+  /// @brief Экранные координаты Y вершин, сверху вниз
+  std::vector<float> screenY;
+  /// @brief Глубина вершин от 0 до 1
+  std::vector<float> screenZ;
+  /// @brief Вершина между ближней и дальней плоскостями
+  std::vector<std::uint8_t> inside;
+  /// @brief Отрезки каждого потока подготовки
+  std::vector<std::vector<Segment_t>> segments;
+  /// @brief Номера отрезков по потокам подготовки и плиткам
+  std::vector<std::vector<std::vector<std::uint32_t>>> edgeBins;
+  /// @brief Номера вершин по потокам подготовки и плиткам
+  std::vector<std::vector<std::vector<std::uint32_t>>> pointBins;
+  /// @brief Кол-во ребер в кадре
+  std::size_t edgeCount = 0;
+};
+
+}  // namespace s21
+
+#endif  // S21_SOFTWARE_RENDERER_H
\ No newline at end of file
@@ -7,20 +7,160 @@ Backend::Backend() {
   TransformationMatrix.setIdentity();
 }
 
+Backend::~Backend() {
+  if (snapshot) std::fclose(snapshot);
+}
+
 void Backend::clearTransformation() { TransformationMatrix.setIdentity(); }
 
-Status_e Backend::readModel(const std::string &fileName) {
-  Status_e readingStatus = model.readFile(fileName);
+Status_e Backend::readModel(const std::string &file,
+                            const LoadOptions_t &loadOptions) {
+  mesh.clear();
+  clusters.clear();
+  voxels.clear();
+  if (snapshot) {
+    std::fclose(snapshot);
+    snapshot = nullptr;
+  }
+  fileName = file;
+  options = loadOptions;
+  infoCurrent = false;
+  geometryLoaded = true;
+  geometryStatus = Status_e::OK;
+  Status_e readingStatus = model.readFile(fileName, options);
+  if (readingStatus == Status_e::OK && options.normals) buildMesh();
   return readingStatus;
 }
 
 const std::vector<Vertex_t> &Backend::getVertices() {
+  restoreGeometry();
   return model.getVertex();
 }
 
-const std::vector<Face_t> &Backend::getFaces() { return model.getFace(); }
+const std::vector<Vertex_t> &Backend::getDisplayVertices() {
+  restoreGeometry();
+  if (!isPointCloud() || pointCloudResolution == 0) return model.getVertex();
+  buildVoxels();
+  return voxels.getPoints();
+}
+
+bool Backend::isPointCloud() {
+  return (geometryLoaded ? model.getFaceCount() : info.faces) == 0;
+}
+
+void Backend::setPointCloudResolution(unsigned int resolution) {
+  if (resolution != pointCloudResolution) {
+    voxels.clear();
+    infoCurrent = false;
+  }
+  pointCloudResolution = resolution;
+}
+
+const std::vector<Face_t> &Backend::getFaces() {
+  restoreGeometry();
+  return model.getFace();
+}
+
+const std::vector<Edge_t> &Backend::getEdges() {
+  restoreGeometry();
+  return model.getEdge();
+}
+
+const std::vector<Edge_t> &Backend::getUniqueEdges() {
+  restoreGeometry();
+  return model.getUniqueEdges();
+}
+
+const std::vector<Triangle_t> &Backend::getTriangles() {
+  buildMesh();
+  return mesh.getTriangles();
+}
+
+const std::vector<Vertex_t> &Backend::getNormals() {
+  buildMesh();
+  return mesh.getNormals();
+}
+
+const std::vector<unsigned char> &Backend::getEdgeMasks() {
+  buildMesh();
+  return mesh.getEdgeMasks();
+}
+
+const std::vector<unsigned int> &Backend::getEdgeStrips() {
+  buildClusters();
+  return clusters.getStripIndices();
+}
+
+const std::vector<std::size_t> &Backend::getEdgeStripStarts() {
+  buildClusters();
+  return clusters.getStripStarts();
+}
+
+const std::vector<Cluster_t> &Backend::getEdgeClusters() {
+  buildClusters();
+  return clusters.getClusters();
+}
 
-const std::vector<Edge_t> &Backend::getEdges() { return model.getEdge(); }
+const ModelInfo_t &Backend::getInfo() {
+  if (!infoCurrent) {
+    info = {getVertices().size(), getDisplayVertices().size(),
+            model.getFaceCount(), model.getEdgeCount(), model.getBounds()};
+    infoCurrent = true;
+  }
+  return info;
+}
+
+void Backend::releaseGeometry() {
+  getInfo();
+  if (!snapshot && geometryLoaded) {
+    snapshot = std::tmpfile();
+    if (snapshot && !model.saveSnapshot(snapshot)) {
+      std::fclose(snapshot);
+      snapshot = nullptr;
+    }
+  }
+  model.clearModel();
+  mesh.clear();
+  clusters.clear();
+  voxels.clear();
+  geometryLoaded = false;
+}
+
+bool Backend::isGeometryLoaded() const { return geometryLoaded; }
+
+Status_e Backend::restoreGeometry() {
+  if (!geometryLoaded && geometryStatus == Status_e::OK) {
+    geometryStatus = snapshot ? model.loadSnapshot(snapshot, options)
+                              : model.readFile(fileName, options);
+    if (geometryStatus == Status_e::OK &&
+        (model.getVertex().size() != info.vertices ||
+         model.getFaceCount() != info.faces)) {
+      geometryStatus = Status_e::FileCurrupted;
+    }
+    if (geometryStatus == Status_e::OK) {
+      geometryLoaded = true;
+    } else {
+      model.clearModel();
+      info = {0, 0, 0, 0, Bounds_t()};
+    }
+  }
+  return geometryStatus;
+}
+
+void Backend::buildMesh() {
+  restoreGeometry();
+  if (!mesh.isBuilt()) mesh.build(model.getVertex(), model.getFace());
+}
+
+void Backend::buildClusters() {
+  restoreGeometry();
+  if (!clusters.isBuilt()) clusters.build(model.getVertex(), model.getEdge());
+}
+
+void Backend::buildVoxels() {
+  restoreGeometry();
+  if (!voxels.isBuilt()) voxels.build(model.getVertex(), pointCloudResolution);
+}
 
 const Matrix &Backend::getTransformationMatrix() {
   return TransformationMatrix;
@@ -74,10 +214,11 @@ TransformationStrategy *Backend::updateStrategy(
 }
 
 bool Backend::isZeroTransform(Matrix mat) {
-  return !((std::abs(mat[0][0]) > 1e-15 && std::abs(mat[1][1]) > 1e-15 &&
-            std::abs(mat[2][2]) > 1e-15) &&
-           (std::abs(mat[0][0]) < 1e25 && std::abs(mat[1][1]) < 1e25 &&
-            std::abs(mat[2][2]) < 1e25));
+  double determinant =
+      mat[0][0] * (mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1]) -
+      mat[0][1] * (mat[1][0] * mat[2][2] - mat[1][2] * mat[2][0]) +
+      mat[0][2] * (mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0]);
+  return !(std::abs(determinant) > 1e-15 && std::abs(determinant) < 1e25);
 }
 
 }  // namespace s21
\ No newline at end of file
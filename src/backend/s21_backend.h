@@ -10,8 +10,14 @@
 #ifndef S21_BACKEND_H
 #define S21_BACKEND_H
 
+#include "image/s21_qoi.h"
 #include "matrix/s21_matrix.h"
+#include "mesh/s21_clusters.h"
+#include "mesh/s21_mesh.h"
+#include "mesh/s21_voxel_grid.h"
 #include "model/s21_model.h"
+#include "render/s21_software_renderer.h"
+#include "transform/s21_animation.h"
 #include "transform/s21_transform.h"
 
 namespace s21 {
@@ -21,25 +27,77 @@ class Backend : public Observable {
  public:
   /// @brief Стандартный конструктор
   Backend();
-  /// @brief Стандартный деструктор
-  ~Backend() = default;
+  /// @brief Деструктор, удаляет снимок геометрии
+  ~Backend();
 
   /// @brief Очистка матрицы трансформаций
   void clearTransformation();
   /// @brief Чтение новой модели
-  /// @param fileName Путь к файлу модели
+  /// @param file Путь к файлу модели
+  /// @param loadOptions Что построить сразу, остальное строится при первом
+  /// запросе
   /// @return Статус прочтения файла
-  Status_e readModel(const std::string &fileName);
+  Status_e readModel(const std::string &file,
+                     const LoadOptions_t &loadOptions = LoadOptions_t());
 
   /// @brief Получение ссылки на вектор вершин
   /// @return Ссылка на вектор вершин
   const std::vector<Vertex_t> &getVertices();
+  /// @brief Получение отображаемых вершин: для облака точек с включенным
+  /// прореживанием - центры вокселей, строятся при первом запросе, иначе
+  /// вершины модели
+  /// @return Вектор вершин
+  const std::vector<Vertex_t> &getDisplayVertices();
+  /// @brief Является ли модель облаком точек
+  /// @return true, если у модели нет поверхностей
+  bool isPointCloud();
+  /// @brief Установка разрешения воксельной сетки облака точек
+  /// @param resolution Кол-во вокселей по наибольшей оси, 0 - без прореживания
+  void setPointCloudResolution(unsigned int resolution);
   /// @brief Получение ссылки на вектор поверхностей
   /// @return Вектор поверхностей
   const std::vector<Face_t> &getFaces();
   /// @brief Получение ссылки на вектор ребер
   /// @return Вектор ребер
   const std::vector<Edge_t> &getEdges();
+  /// @brief Получение уникальных ребер, строятся при первом запросе
+  /// @return Вектор ребер
+  const std::vector<Edge_t> &getUniqueEdges();
+  /// @brief Получение треугольников поверхности, строится при первом запросе
+  /// @return Вектор треугольников
+  const std::vector<Triangle_t> &getTriangles();
+  /// @brief Получение нормалей вершин, строятся при первом запросе
+  /// @return Вектор нормалей
+  const std::vector<Vertex_t> &getNormals();
+  /// @brief Получение масок ребер треугольников поверхности
+  /// @return Вектор масок
+  const std::vector<unsigned char> &getEdgeMasks();
+  /// @brief Получение индексов ломаных ребер для GL_LINE_STRIP
+  /// @return Вектор индексов с разделителями STRIP_RESTART
+  const std::vector<unsigned int> &getEdgeStrips();
+  /// @brief Получение начал ломаных ребер в векторе индексов
+  /// @return Вектор начал
+  const std::vector<std::size_t> &getEdgeStripStarts();
+  /// @brief Получение кластеров ребер, строятся при первом запросе
+  /// @return Вектор кластеров
+  const std::vector<Cluster_t> &getEdgeClusters();
+  /// @brief Получение сведений о модели, считаются при первом запросе
+  /// @return Сведения о модели
+  const ModelInfo_t &getInfo();
+  /// @brief Освобождение геометрии модели в оперативной памяти, сведения о
+  /// модели сохраняются. При первом освобождении модель записывается в
+  /// двоичный снимок во временном файле, любой запрос геометрии читает его
+  void releaseGeometry();
+  /// @brief Загружена ли геометрия модели
+  /// @return false после releaseGeometry до следующего запроса геометрии
+  bool isGeometryLoaded() const;
+  /// @brief Повторное чтение геометрии, если она освобождена: из снимка, а
+  /// если его не удалось записать - из файла модели.
+  /// Чтение выполняется один раз: если оно не удалось или кол-во вершин и
+  /// поверхностей разошлось со сведениями, геометрия остается пустой до
+  /// следующей загрузки модели
+  /// @return Статус чтения, FileCurrupted при расхождении со сведениями
+  Status_e restoreGeometry();
   /// @brief Получение ссылки на матрицу трансформаций
   /// @return Матрица трансформаций
   const Matrix &getTransformationMatrix();
@@ -61,15 +119,43 @@ class Backend : public Observable {
  private:
   /// @brief Проверка, не приводит ли трансформация к нулевой матрице
   /// @param mat Матрица трансформаций после применения новой трансформации
-  /// @return Возвращает true, когда один из масштбных коэффициентов становится
-  /// равен нулю
+  /// @return Возвращает true, когда матрица вырождается: определитель
+  /// поворота и масштаба близок к нулю или слишком велик
   bool isZeroTransform(Matrix mat);
+  /// @brief Построение поверхности модели, если она еще не построена
+  void buildMesh();
+  /// @brief Построение кластеров ребер, если они еще не построены
+  void buildClusters();
+  /// @brief Прореживание облака точек, если оно еще не построено
+  void buildVoxels();
   /// @brief Матрица трансформаций
   Matrix TransformationMatrix;
-  /// @brief Ссылка на синглтон модели
-  Model &model = Model::getModel();
+  /// @brief Модель, принадлежит бэкенду
+  Model model;
   /// @brief Контекст трансформации
   TransformationContext context;
+  /// @brief Поверхность модели
+  Mesh mesh;
+  /// @brief Кластеры ребер модели
+  EdgeClusters clusters;
+  /// @brief Прореженное облако точек
+  VoxelGrid voxels;
+  /// @brief Разрешение воксельной сетки облака точек
+  unsigned int pointCloudResolution = 0;
+  /// @brief Путь к файлу модели
+  std::string fileName;
+  /// @brief Параметры загрузки модели
+  LoadOptions_t options;
+  /// @brief Сведения о модели
+  ModelInfo_t info = {0, 0, 0, 0, Bounds_t()};
+  /// @brief Сведения о модели актуальны
+  bool infoCurrent = false;
+  /// @brief Геометрия модели загружена
+  bool geometryLoaded = true;
+  /// @brief Статус последнего повторного чтения геометрии
+  Status_e geometryStatus = Status_e::OK;
+  /// @brief Временный файл со снимком геометрии, удаляется при закрытии
+  std::FILE *snapshot = nullptr;
 };
 }  // namespace s21
 
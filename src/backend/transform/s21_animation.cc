@@ -0,0 +1,90 @@
+#include "s21_animation.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Линейная интерполяция
+/// @param a Начало
+/// @param b Конец
+/// @param t Доля от 0 до 1
+/// @return Значение
+float lerp(float a, float b, float t) { return a + (b - a) * t; }
+
+/// @brief Линейная интерполяция точки
+/// @param a Начало
+/// @param b Конец
+/// @param t Доля от 0 до 1
+/// @return Точка
+Vertex_t lerp(const Vertex_t &a, const Vertex_t &b, float t) {
+  return Vertex_t(lerp(a.x, b.x, t), lerp(a.y, b.y, t), lerp(a.z, b.z, t));
+}
+
+}  // namespace
+
+Animation Animation::turntable(float duration, float turns, float zoomFrom,
+                               float zoomTo) {
+  Animation animation;
+  Keyframe_t start;
+  start.scale = zoomFrom;
+  Keyframe_t end;
+  end.time = duration;
+  end.rotation.y = 360.0f * turns;
+  end.scale = zoomTo;
+  animation.addKeyframe(start);
+  animation.addKeyframe(end);
+  return animation;
+}
+
+void Animation::addKeyframe(const Keyframe_t &keyframe) {
+  auto position = std::upper_bound(
+      keyframes.begin(), keyframes.end(), keyframe.time,
+      [](float time, const Keyframe_t &other) { return time < other.time; });
+  keyframes.insert(position, keyframe);
+}
+
+float Animation::getDuration() const {
+  return keyframes.empty() ? 0.0f : keyframes.back().time;
+}
+
+std::size_t Animation::frameCount(int fps) const {
+  double frames = std::round(static_cast<double>(getDuration()) * fps);
+  return std::max<std::size_t>(1, static_cast<std::size_t>(frames));
+}
+
+Keyframe_t Animation::sample(float time) const {
+  if (keyframes.empty()) return Keyframe_t();
+  if (time <= keyframes.front().time) return keyframes.front();
+  if (time >= keyframes.back().time) return keyframes.back();
+  auto next = std::upper_bound(
+      keyframes.begin(), keyframes.end(), time,
+      [](float value, const Keyframe_t &other) { return value < other.time; });
+  const Keyframe_t &a = *(next - 1);
+  const Keyframe_t &b = *next;
+  float t = (time - a.time) / (b.time - a.time);
+  Keyframe_t frame;
+  frame.time = time;
+  frame.rotation = lerp(a.rotation, b.rotation, t);
+  frame.translation = lerp(a.translation, b.translation, t);
+  frame.scale = lerp(a.scale, b.scale, t);
+  return frame;
+}
+
+std::vector<TransformationStep_t> Animation::getSteps(float time) const {
+  Keyframe_t frame = sample(time);
+  std::pair<TransformationName_e, float> values[] = {
+      {Scale, frame.scale - 1.0f},
+      {RotateX, frame.rotation.x},
+      {RotateY, frame.rotation.y},
+      {RotateZ, frame.rotation.z},
+      {TranslationX, frame.translation.x},
+      {TranslationY, frame.translation.y},
+      {TranslationZ, frame.translation.z}};
+  std::vector<TransformationStep_t> steps;
+  for (const auto &[transformation, value] : values) {
+    if (value != 0.0f) steps.push_back({transformation, true, value});
+  }
+  return steps;
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,72 @@
+/// @mainpage
+/// @file s21_animation.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_ANIMATION_H
+#define S21_ANIMATION_H
+
+#include "s21_transform.h"
+
+namespace s21 {
+
+/// @brief Ключевой кадр анимации
+struct Keyframe_t {
+  /// @brief Время кадра, с
+  float time = 0.0f;
+  /// @brief Углы поворота вокруг осей, градусы
+  Vertex_t rotation;
+  /// @brief Перемещение вдоль осей
+  Vertex_t translation;
+  /// @brief Масштаб
+  float scale = 1.0f;
+};
+
+/// @brief Анимация трансформации модели по ключевым кадрам.
+/// Между ключевыми кадрами значения интерполируются линейно, кадр видео
+/// определяется только своим номером и частотой кадров, а не временем
+/// отрисовки.
+class Animation {
+ public:
+  /// @brief Вращение вокруг оси Y с изменением масштаба
+  /// @param duration Длительность, с
+  /// @param turns Кол-во оборотов
+  /// @param zoomFrom Масштаб в начале
+  /// @param zoomTo Масштаб в конце
+  /// @return Анимация из двух ключевых кадров
+  static Animation turntable(float duration, float turns = 1.0f,
+                             float zoomFrom = 1.0f, float zoomTo = 1.0f);
+
+  /// @brief Добавление ключевого кадра, кадры упорядочиваются по времени
+  /// @param keyframe Ключевой кадр
+  void addKeyframe(const Keyframe_t &keyframe);
+  /// @brief Длительность анимации
+  /// @return Время последнего ключевого кадра, с
+  float getDuration() const;
+  /// @brief Кол-во кадров видео. Последний кадр не повторяет первый, поэтому
+  /// полный оборот зацикливается без рывка
+  /// @param fps Кадров в секунду
+  /// @return Кол-во кадров, не меньше 1
+  std::size_t frameCount(int fps) const;
+  /// @brief Значения анимации в момент времени
+  /// @param time Время, с, вне анимации берется ближайший ключевой кадр
+  /// @return Интерполированный кадр
+  Keyframe_t sample(float time) const;
+  /// @brief Шаги трансформации кадра, применяются к единичной матрице:
+  /// масштаб, повороты вокруг X, Y, Z, перемещение
+  /// @param time Время, с
+  /// @return Шаги трансформации
+  std::vector<TransformationStep_t> getSteps(float time) const;
+
+ private:
+  /// @brief Ключевые кадры по возрастанию времени
+  std::vector<Keyframe_t> keyframes;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -112,4 +112,35 @@ Matrix TransformationContext::applyTransformation() const {
   return transformation;
 }
 
+bool parseTransformations(const std::string &text,
+                          std::vector<TransformationStep_t> &steps) {
+  static const std::pair<const char *, TransformationName_e> keys[] = {
+      {"tx", TranslationX}, {"ty", TranslationY}, {"tz", TranslationZ},
+      {"s", Scale},         {"rx", RotateX},      {"ry", RotateY},
+      {"rz", RotateZ}};
+  std::vector<TransformationStep_t> parsed;
+  std::istringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ',')) {
+    if (item.empty()) continue;
+    std::size_t equals = item.find('=');
+    if (equals == std::string::npos) return false;
+    std::string key = item.substr(0, equals);
+    const auto *found =
+        std::find_if(std::begin(keys), std::end(keys),
+                     [&key](const auto &entry) { return key == entry.first; });
+    if (found == std::end(keys)) return false;
+    std::istringstream number(item.substr(equals + 1));
+    float value = 0.0f;
+    if (!(number >> value) || !(number >> std::ws).eof()) return false;
+    if (found->second == Scale) {
+      if (value <= 0.0f) return false;
+      value -= 1.0f;
+    }
+    parsed.push_back({found->second, true, value});
+  }
+  steps.insert(steps.end(), parsed.begin(), parsed.end());
+  return true;
+}
+
 }  // namespace s21
\ No newline at end of file
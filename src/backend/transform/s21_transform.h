@@ -25,6 +25,16 @@ enum TransformationName_e {
   RotateZ
 };
 
+/// @brief Шаг трансформации для пакетного применения
+struct TransformationStep_t {
+  /// @brief Тип трансформации
+  TransformationName_e transformation;
+  /// @brief Мышкой произведена трансформация
+  bool isMouse;
+  /// @brief Числовое значение трансформации
+  float direction;
+};
+
 /// @brief Виртуальный класс стратегий
 class TransformationStrategy {
  public:
@@ -166,6 +176,15 @@ class TransformationContext {
   TransformationStrategy *strategy;
 };
 
+/// @brief Разбор последовательности трансформаций вида "rx=30,s=1.5,tx=0.2".
+/// Ключи tx, ty, tz - перемещение, rx, ry, rz - поворот в градусах, s -
+/// множитель масштаба. Шаги применяются в порядке записи
+/// @param text Последовательность через запятую
+/// @param steps Шаги трансформаций, дополняются при успехе
+/// @return false, если встречен неизвестный ключ или неверное число
+bool parseTransformations(const std::string &text,
+                          std::vector<TransformationStep_t> &steps);
+
 }  // namespace s21
 
 #endif
\ No newline at end of file
@@ -11,12 +11,24 @@
 #define S21_COMMON_H
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 /// @brief Минимальная точность для float
@@ -66,6 +78,73 @@ struct Edge_t {
   // }
 };
 
+/// @brief Структура треугольника поверхности
+struct Triangle_t {
+  /// @brief Первая точка треугольника
+  unsigned int a;
+  /// @brief Вторая точка треугольника
+  unsigned int b;
+  /// @brief Третья точка треугольника
+  unsigned int c;
+};
+
+/// @brief Структура пространственного кластера ребер
+struct Cluster_t {
+  /// @brief Первое ребро кластера в упорядоченном векторе ребер
+  std::size_t offset;
+  /// @brief Кол-во ребер кластера
+  std::size_t count;
+  /// @brief Первый индекс кластера в буфере ломаных
+  std::size_t indexOffset;
+  /// @brief Кол-во индексов кластера вместе с разделителями
+  std::size_t indexCount;
+  /// @brief Первая ломаная кластера
+  std::size_t firstStrip;
+  /// @brief Кол-во ломаных кластера
+  std::size_t strips;
+  /// @brief Минимальный угол ограничивающего параллелепипеда
+  Vertex_t min;
+  /// @brief Максимальный угол ограничивающего параллелепипеда
+  Vertex_t max;
+};
+
+/// @brief Ограничивающий параллелепипед
+struct Bounds_t {
+  /// @brief Минимальный угол
+  Vertex_t min;
+  /// @brief Максимальный угол
+  Vertex_t max;
+};
+
+/// @brief Что строится сразу при чтении модели. Все остальное строится при
+/// первом запросе, значения по умолчанию повторяют прежнее поведение
+struct LoadOptions_t {
+  /// @brief Поверхности, без них читаются только вершины
+  bool faces = true;
+  /// @brief Все ребра поверхностей, общие ребра повторяются
+  bool edges = true;
+  /// @brief Уникальные ребра
+  bool uniqueEdges = false;
+  /// @brief Ограничивающий параллелепипед
+  bool bounds = false;
+  /// @brief Треугольники поверхности и нормали вершин
+  bool normals = false;
+};
+
+/// @brief Сведения о модели, доступные и после освобождения геометрии
+struct ModelInfo_t {
+  /// @brief Кол-во вершин
+  std::size_t vertices;
+  /// @brief Кол-во отображаемых вершин
+  std::size_t displayed;
+  /// @brief Кол-во поверхностей
+  std::size_t faces;
+  /// @brief Кол-во ребер
+  std::size_t edges;
+  /// @brief Ограничивающий параллелепипед
+  Bounds_t bounds;
+};
+
 /// @brief Клас наблюдателя
 class Observer {
  public:
@@ -0,0 +1,47 @@
+/// @mainpage
+/// @file s21_memory.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_MEMORY_H
+#define S21_MEMORY_H
+
+#include "s21_common.h"
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace s21 {
+
+/// @brief Объем резидентной памяти процесса
+/// @return Байт в оперативной памяти, 0 - если платформа не поддерживается
+inline std::size_t residentMemory() {
+  std::size_t resident = 0;
+#if defined(__APPLE__)
+  mach_task_basic_info_data_t taskInfo;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&taskInfo),
+                &count) == KERN_SUCCESS) {
+    resident = taskInfo.resident_size;
+  }
+#elif defined(__linux__)
+  std::ifstream statm("/proc/self/statm");
+  std::size_t size = 0, pages = 0;
+  if (statm >> size >> pages) {
+    resident = pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+  return resident;
+}
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
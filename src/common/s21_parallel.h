@@ -0,0 +1,152 @@
+/// @mainpage
+/// @file s21_parallel.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_PARALLEL_H
+#define S21_PARALLEL_H
+
+#include "s21_thread_pool.h"
+
+/// @brief Минимальное кол-во элементов на один поток
+#define PARALLEL_GRAIN 16384
+
+namespace s21 {
+
+/// @brief Кол-во потоков для обработки диапазона
+/// @param count Кол-во элементов
+/// @param grain Минимальное кол-во элементов на поток
+/// @return Кол-во потоков, не меньше 1
+inline std::size_t parallelWorkers(std::size_t count,
+                                   std::size_t grain = PARALLEL_GRAIN) {
+  std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+  std::size_t needed = (count + grain - 1) / std::max<std::size_t>(grain, 1);
+  return std::max<std::size_t>(1, std::min(hardware, needed));
+}
+
+/// @brief Обработка диапазона [0, count) заданным числом непрерывных кусков.
+/// Разбиение детерминировано: кусок i - [count * i / chunks,
+/// count * (i + 1) / chunks). Куски разбирают вызывающий поток и потоки
+/// общего ThreadPool, новые потоки не создаются. Возврат - после
+/// обработки всех кусков.
+/// @param count Кол-во элементов
+/// @param chunks Кол-во кусков
+/// @param function Функция вида function(chunk, begin, end)
+template <typename Function>
+void parallelForChunks(std::size_t count, std::size_t chunks,
+                       Function function) {
+  struct Batch {
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+  std::shared_ptr<Batch> batch = std::make_shared<Batch>();
+  // Задача пула может начаться после возврата, когда куски уже разобраны:
+  // тогда она обращается только к batch, но не к function
+  auto run = [batch, &function, count, chunks]() {
+    for (std::size_t chunk = batch->next++; chunk < chunks;
+         chunk = batch->next++) {
+      function(chunk, count * chunk / chunks, count * (chunk + 1) / chunks);
+      if (++batch->done == chunks) {
+        std::lock_guard<std::mutex> lock(batch->mutex);
+        batch->finished.notify_all();
+      }
+    }
+  };
+  ThreadPool &pool = ThreadPool::instance();
+  std::size_t helpers = std::min(pool.size(), chunks ? chunks - 1 : 0);
+  for (std::size_t i = 0; i < helpers; ++i) pool.submit(run);
+  run();
+  std::unique_lock<std::mutex> lock(batch->mutex);
+  batch->finished.wait(lock, [&batch, chunks] {
+    return batch->done.load() == chunks;
+  });
+}
+
+/// @brief Параллельная обработка диапазона [0, count)
+/// @param count Кол-во элементов
+/// @param function Функция вида function(begin, end)
+/// @param grain Минимальное кол-во элементов на поток
+template <typename Function>
+void parallelFor(std::size_t count, Function function,
+                 std::size_t grain = PARALLEL_GRAIN) {
+  parallelForChunks(count, parallelWorkers(count, grain),
+                    [&function](std::size_t, std::size_t begin,
+                                std::size_t end) { function(begin, end); });
+}
+
+/// @brief Параллельная исключающая префиксная сумма на месте
+/// @param values Значения, заменяются суммами предыдущих элементов
+/// @return Сумма всех элементов
+template <typename T>
+T parallelExclusiveScan(std::vector<T> &values) {
+  std::size_t chunks = parallelWorkers(values.size());
+  std::vector<T> sums(chunks, T());
+  parallelForChunks(values.size(), chunks,
+                    [&values, &sums](std::size_t chunk, std::size_t begin,
+                                     std::size_t end) {
+                      T sum = T();
+                      for (std::size_t i = begin; i < end; ++i) {
+                        sum += values[i];
+                      }
+                      sums[chunk] = sum;
+                    });
+  T total = T();
+  for (T &sum : sums) {
+    T value = sum;
+    sum = total;
+    total += value;
+  }
+  parallelForChunks(values.size(), chunks,
+                    [&values, &sums](std::size_t chunk, std::size_t begin,
+                                     std::size_t end) {
+                      T sum = sums[chunk];
+                      for (std::size_t i = begin; i < end; ++i) {
+                        T value = values[i];
+                        values[i] = sum;
+                        sum += value;
+                      }
+                    });
+  return total;
+}
+
+/// @brief Параллельный расчет ограничивающего параллелепипеда точек
+/// @param points Непустой вектор точек
+/// @return Ограничивающий параллелепипед
+inline Bounds_t parallelBounds(const std::vector<Vertex_t> &points) {
+  std::size_t chunks = parallelWorkers(points.size());
+  std::vector<Bounds_t> partial(chunks, {points.front(), points.front()});
+  parallelForChunks(points.size(), chunks,
+                    [&points, &partial](std::size_t chunk, std::size_t begin,
+                                        std::size_t end) {
+                      Bounds_t &bounds = partial[chunk];
+                      for (std::size_t i = begin; i < end; ++i) {
+                        const Vertex_t &point = points[i];
+                        bounds.min.x = std::min(bounds.min.x, point.x);
+                        bounds.min.y = std::min(bounds.min.y, point.y);
+                        bounds.min.z = std::min(bounds.min.z, point.z);
+                        bounds.max.x = std::max(bounds.max.x, point.x);
+                        bounds.max.y = std::max(bounds.max.y, point.y);
+                        bounds.max.z = std::max(bounds.max.z, point.z);
+                      }
+                    });
+  Bounds_t bounds = partial.front();
+  for (const Bounds_t &part : partial) {
+    bounds.min.x = std::min(bounds.min.x, part.min.x);
+    bounds.min.y = std::min(bounds.min.y, part.min.y);
+    bounds.min.z = std::min(bounds.min.z, part.min.z);
+    bounds.max.x = std::max(bounds.max.x, part.max.x);
+    bounds.max.y = std::max(bounds.max.y, part.max.y);
+    bounds.max.z = std::max(bounds.max.z, part.max.z);
+  }
+  return bounds;
+}
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
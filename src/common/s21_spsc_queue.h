@@ -0,0 +1,74 @@
+/// @mainpage
+/// @file s21_spsc_queue.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_SPSC_QUEUE_H
+#define S21_SPSC_QUEUE_H
+
+#include "s21_common.h"
+
+/// @brief Размер строки кэша для разнесения счетчиков очереди
+#define CACHE_LINE_SIZE 64
+
+namespace s21 {
+
+/// @brief Ограниченная очередь без блокировок для одного писателя и одного
+/// читателя. Счетчики только растут, ячейка - счетчик по модулю емкости.
+/// Писатель владеет tail, читатель - head, каждый читает чужой счетчик с
+/// acquire, поэтому содержимое ячейки видно до смены счетчика.
+/// @tparam T Тип элемента, перемещаемый
+template <typename T>
+class SpscQueue {
+ public:
+  /// @brief Конструктор
+  /// @param capacity Емкость очереди, не меньше 1
+  explicit SpscQueue(std::size_t capacity)
+      : slots(std::max<std::size_t>(capacity, 1)) {}
+
+  /// @brief Добавление элемента, вызывается только писателем
+  /// @param value Элемент, перемещается при успехе
+  /// @return false, если очередь заполнена
+  bool tryPush(T &&value) {
+    std::size_t position = tail.load(std::memory_order_relaxed);
+    if (position - head.load(std::memory_order_acquire) == slots.size()) {
+      return false;
+    }
+    slots[position % slots.size()] = std::move(value);
+    tail.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief Извлечение элемента, вызывается только читателем
+  /// @param value Куда переместить элемент
+  /// @return false, если очередь пуста
+  bool tryPop(T &value) {
+    std::size_t position = head.load(std::memory_order_relaxed);
+    if (position == tail.load(std::memory_order_acquire)) return false;
+    T &slot = slots[position % slots.size()];
+    value = std::move(slot);
+    slot = T();
+    head.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief Емкость очереди
+  /// @return Максимальное кол-во элементов
+  std::size_t capacity() const { return slots.size(); }
+
+ private:
+  /// @brief Ячейки очереди
+  std::vector<T> slots;
+  /// @brief Кол-во извлеченных элементов, пишет читатель
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head{0};
+  /// @brief Кол-во добавленных элементов, пишет писатель
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail{0};
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
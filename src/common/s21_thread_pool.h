@@ -0,0 +1,99 @@
+/// @mainpage
+/// @file s21_thread_pool.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include "s21_common.h"
+
+namespace s21 {
+
+/// @brief Пул потоков, созданных один раз на все время работы программы.
+/// Задачи берутся из общей очереди под мьютексом. Пул не ждет задачи сам:
+/// вызывающий поток выполняет работу наравне с потоками пула, поэтому
+/// вложенные вызовы из задач не блокируются, даже если пул занят.
+class ThreadPool {
+ public:
+  /// @brief Общий пул на все ядра, кроме вызывающего потока
+  /// @return Ссылка на пул
+  static ThreadPool &instance() {
+    static ThreadPool pool(
+        std::max(1u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+  }
+
+  /// @brief Конструктор, запускает потоки
+  /// @param count Кол-во потоков, 0 - задачи не принимаются
+  explicit ThreadPool(std::size_t count) {
+    threads.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      threads.emplace_back(&ThreadPool::work, this);
+    }
+  }
+  /// @brief Деструктор, дожидается задач в очереди и останавливает потоки
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopping = true;
+    }
+    condition.notify_all();
+    for (std::thread &thread : threads) thread.join();
+  }
+
+  /// @brief Удаление конструктора копирования
+  ThreadPool(const ThreadPool &) = delete;
+  /// @brief Удаление оператора копирования
+  /// @return Нет возвращения
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// @brief Кол-во потоков пула
+  /// @return Кол-во потоков
+  std::size_t size() const { return threads.size(); }
+
+  /// @brief Добавление задачи в очередь
+  /// @param task Задача
+  void submit(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.push_back(std::move(task));
+    }
+    condition.notify_one();
+  }
+
+ private:
+  /// @brief Цикл потока пула
+  void work() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [this] { return stopping || !tasks.empty(); });
+        if (tasks.empty()) return;
+        task = std::move(tasks.front());
+        tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  /// @brief Потоки пула
+  std::vector<std::thread> threads;
+  /// @brief Очередь задач
+  std::deque<std::function<void()>> tasks;
+  /// @brief Мьютекс очереди
+  std::mutex mutex;
+  /// @brief Появление задачи или остановка пула
+  std::condition_variable condition;
+  /// @brief Пул останавливается
+  bool stopping = false;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -12,14 +12,16 @@ Controller::~Controller() {
   delete backend_;
 }
 
-Status_e Controller::loadModel(const std::string &fileName) {
-  Status_e res = backend_->readModel(fileName);
+Status_e Controller::loadModel(const std::string &fileName,
+                               const LoadOptions_t &options) {
+  Status_e res = backend_->readModel(fileName, options);
   if (res == Status_e::OK) {
     backend_->notifyUpdate();
     clearTransformation();
     currentFileName = fileName;
+    currentOptions = options;
   } else {
-    backend_->readModel(currentFileName);
+    backend_->readModel(currentFileName, currentOptions);
   }
   return res;
 }
@@ -30,6 +32,15 @@ void Controller::applyTransformation(TransformationName_e transformation,
   backend_->notifyUpdate();
 }
 
+void Controller::applyTransformations(
+    const std::vector<TransformationStep_t> &steps) {
+  for (const TransformationStep_t &step : steps) {
+    backend_->updateTransformation(step.transformation, step.isMouse,
+                                   step.direction);
+  }
+  backend_->notifyUpdate();
+}
+
 void Controller::update() {
   transformation = backend_->getTransformationMatrix();
 }
@@ -40,6 +51,26 @@ const std::vector<Vertex_t> &Controller::getVertices() const {
   return backend_->getVertices();
 }
 
+const std::vector<Vertex_t> &Controller::getDisplayVertices() const {
+  return backend_->getDisplayVertices();
+}
+
+bool Controller::isPointCloud() const { return backend_->isPointCloud(); }
+
+void Controller::setPointCloudResolution(unsigned int resolution) {
+  backend_->setPointCloudResolution(resolution);
+}
+
+const ModelInfo_t &Controller::getInfo() const { return backend_->getInfo(); }
+
+void Controller::releaseGeometry() { backend_->releaseGeometry(); }
+
+bool Controller::isGeometryLoaded() const {
+  return backend_->isGeometryLoaded();
+}
+
+Status_e Controller::restoreGeometry() { return backend_->restoreGeometry(); }
+
 const std::vector<Face_t> &Controller::getFaces() const {
   return backend_->getFaces();
 }
@@ -48,6 +79,34 @@ const std::vector<Edge_t> &Controller::getEdges() const {
   return backend_->getEdges();
 }
 
+const std::vector<Edge_t> &Controller::getUniqueEdges() const {
+  return backend_->getUniqueEdges();
+}
+
+const std::vector<Triangle_t> &Controller::getTriangles() const {
+  return backend_->getTriangles();
+}
+
+const std::vector<Vertex_t> &Controller::getNormals() const {
+  return backend_->getNormals();
+}
+
+const std::vector<unsigned char> &Controller::getEdgeMasks() const {
+  return backend_->getEdgeMasks();
+}
+
+const std::vector<unsigned int> &Controller::getEdgeStrips() const {
+  return backend_->getEdgeStrips();
+}
+
+const std::vector<std::size_t> &Controller::getEdgeStripStarts() const {
+  return backend_->getEdgeStripStarts();
+}
+
+const std::vector<Cluster_t> &Controller::getEdgeClusters() const {
+  return backend_->getEdgeClusters();
+}
+
 Matrix Controller::getTransformation() const { return transformation; }
 
 void Controller::clearTransformation() {
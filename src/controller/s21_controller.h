@@ -24,8 +24,11 @@ class Controller : public Observer {
 
   /// @brief Загрузка модели
   /// @param fileName Путь до модели
+  /// @param options Что построить сразу, остальное строится при первом
+  /// запросе
   /// @return Статус прочтения файла
-  Status_e loadModel(const std::string &fileName);
+  Status_e loadModel(const std::string &fileName,
+                     const LoadOptions_t &options = LoadOptions_t());
 
   /// @brief Применение трансформации
   /// @param Transformation Тип трансформации
@@ -33,6 +36,9 @@ class Controller : public Observer {
   /// @param direction Числовое значения применения данной трансформации
   void applyTransformation(TransformationName_e transformation, bool isMouse,
                            float direction);
+  /// @brief Пакетное применение трансформаций с одним оповещением
+  /// @param steps Шаги трансформаций в порядке применения
+  void applyTransformations(const std::vector<TransformationStep_t> &steps);
 
   /// @brief Перегрузка удаления наблюдателя
   void onObservableDestruction() override;
@@ -45,12 +51,54 @@ class Controller : public Observer {
   /// @brief Получение вершин
   /// @return Ссылка на вектор вершин
   const std::vector<Vertex_t> &getVertices() const;
+  /// @brief Получение отображаемых вершин, для облака точек - прореженных
+  /// @return Ссылка на вектор вершин
+  const std::vector<Vertex_t> &getDisplayVertices() const;
+  /// @brief Является ли модель облаком точек
+  /// @return true, если у модели нет поверхностей
+  bool isPointCloud() const;
+  /// @brief Установка разрешения прореживания облака точек
+  /// @param resolution Кол-во вокселей по наибольшей оси, 0 - без прореживания
+  void setPointCloudResolution(unsigned int resolution);
+  /// @brief Получение сведений о модели без обращения к геометрии
+  /// @return Ссылка на сведения
+  const ModelInfo_t &getInfo() const;
+  /// @brief Освобождение геометрии модели после загрузки в видеопамять.
+  /// Геометрия читается из двоичного снимка при следующем запросе
+  void releaseGeometry();
+  /// @brief Загружена ли геометрия модели
+  /// @return false, если геометрия освобождена
+  bool isGeometryLoaded() const;
+  /// @brief Повторное чтение освобожденной геометрии вне отрисовки кадра
+  /// @return Статус чтения, при ошибке модель остается пустой
+  Status_e restoreGeometry();
   /// @brief Получение поверхностей
   /// @return Ссылка на вектор поверхностей
   const std::vector<Face_t> &getFaces() const;
   /// @brief Получение ребер
   /// @return Ссылка на вектор ребер
   const std::vector<Edge_t> &getEdges() const;
+  /// @brief Получение уникальных ребер
+  /// @return Ссылка на вектор ребер
+  const std::vector<Edge_t> &getUniqueEdges() const;
+  /// @brief Получение треугольников поверхности
+  /// @return Ссылка на вектор треугольников
+  const std::vector<Triangle_t> &getTriangles() const;
+  /// @brief Получение нормалей вершин
+  /// @return Ссылка на вектор нормалей
+  const std::vector<Vertex_t> &getNormals() const;
+  /// @brief Получение масок ребер треугольников
+  /// @return Ссылка на вектор масок
+  const std::vector<unsigned char> &getEdgeMasks() const;
+  /// @brief Получение индексов ломаных ребер
+  /// @return Ссылка на вектор индексов
+  const std::vector<unsigned int> &getEdgeStrips() const;
+  /// @brief Получение начал ломаных ребер
+  /// @return Ссылка на вектор начал
+  const std::vector<std::size_t> &getEdgeStripStarts() const;
+  /// @brief Получение кластеров ребер
+  /// @return Ссылка на вектор кластеров
+  const std::vector<Cluster_t> &getEdgeClusters() const;
 
   /// @brief Получение трансформаций
   /// @return Матрица трансформаций
@@ -63,6 +111,8 @@ class Controller : public Observer {
   Matrix transformation;
   /// @brief Имя нынешнего файла
   std::string currentFileName;
+  /// @brief Параметры загрузки нынешнего файла
+  LoadOptions_t currentOptions;
 };
 
 }  // namespace s21
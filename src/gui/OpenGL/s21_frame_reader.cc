@@ -0,0 +1,128 @@
+#include "s21_frame_reader.h"
+
+namespace s21 {
+
+void FrameReader::initialize() {
+  QOpenGLContext *context = QOpenGLContext::currentContext();
+  gl = context->extraFunctions();
+  QSurfaceFormat format = context->format();
+  if (context->isOpenGLES()) {
+    pixelBuffers = format.majorVersion() >= 3;
+    pixelFormat = GL_RGBA;
+    imageFormat = QImage::Format_RGBA8888;
+    pixelBytes = 4;
+  } else {
+    pixelBuffers = format.version() >= qMakePair(3, 2);
+    pixelFormat = GL_BGR;
+    imageFormat = QImage::Format_BGR888;
+    pixelBytes = 3;
+  }
+}
+
+void FrameReader::cleanup() {
+  discard();
+  for (Slot &slot : slots) {
+    if (slot.buffer != 0) gl->glDeleteBuffers(1, &slot.buffer);
+    slot = Slot();
+  }
+  ready.clear();
+}
+
+void FrameReader::request(GLuint framebuffer, const QSize &size) {
+  if (!pixelBuffers) {
+    ready.push_back(read(framebuffer, size));
+    return;
+  }
+  if (requested - collected == READBACK_BUFFERS) collect(true);
+
+  Slot &slot = slots[requested % READBACK_BUFFERS];
+  std::size_t bytes = rowBytes(size.width()) * size.height();
+  if (slot.buffer == 0) gl->glGenBuffers(1, &slot.buffer);
+  gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+  if (slot.capacity != bytes) {
+    gl->glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(bytes),
+                     nullptr, GL_STREAM_READ);
+    slot.capacity = bytes;
+  }
+  readPixels(framebuffer, size, nullptr);
+  gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  slot.fence = gl->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  slot.size = size;
+  ++requested;
+}
+
+bool FrameReader::poll(QImage &frame) {
+  while (requested > collected && collect(false)) {
+  }
+  if (ready.empty()) return false;
+  frame = std::move(ready.front());
+  ready.pop_front();
+  return true;
+}
+
+bool FrameReader::wait(QImage &frame) {
+  if (ready.empty() && requested > collected) collect(true);
+  return poll(frame);
+}
+
+void FrameReader::discard() {
+  for (; collected < requested; ++collected) {
+    Slot &slot = slots[collected % READBACK_BUFFERS];
+    gl->glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+  }
+  ready.clear();
+}
+
+QImage FrameReader::read(GLuint framebuffer, const QSize &size) {
+  std::vector<uchar> pixels(rowBytes(size.width()) * size.height());
+  readPixels(framebuffer, size, pixels.data());
+  return toImage(pixels.data(), size);
+}
+
+std::size_t FrameReader::rowBytes(int width) const {
+  return static_cast<std::size_t>(width) * pixelBytes;
+}
+
+void FrameReader::readPixels(GLuint framebuffer, const QSize &size,
+                             void *pixels) {
+  gl->glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+  gl->glPixelStorei(GL_PACK_ALIGNMENT, 1);
+  gl->glReadPixels(0, 0, size.width(), size.height(), pixelFormat,
+                   GL_UNSIGNED_BYTE, pixels);
+  gl->glPixelStorei(GL_PACK_ALIGNMENT, 4);
+}
+
+QImage FrameReader::toImage(const uchar *pixels, const QSize &size) const {
+  QImage image(size, imageFormat);
+  std::size_t row = rowBytes(size.width());
+  for (int y = 0; y < size.height(); ++y) {
+    std::memcpy(image.scanLine(y), pixels + (size.height() - 1 - y) * row,
+                row);
+  }
+  return image;
+}
+
+bool FrameReader::collect(bool wait) {
+  Slot &slot = slots[collected % READBACK_BUFFERS];
+  GLenum status = gl->glClientWaitSync(
+      slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0,
+      wait ? GL_TIMEOUT_IGNORED : 0);
+  if (status == GL_TIMEOUT_EXPIRED) return false;
+  gl->glDeleteSync(slot.fence);
+  slot.fence = nullptr;
+
+  gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+  const uchar *pixels = static_cast<const uchar *>(gl->glMapBufferRange(
+      GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(slot.capacity),
+      GL_MAP_READ_BIT));
+  if (pixels) {
+    ready.push_back(toImage(pixels, slot.size));
+    gl->glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+  }
+  gl->glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  ++collected;
+  return true;
+}
+
+}  // namespace s21
\ No newline at end of file
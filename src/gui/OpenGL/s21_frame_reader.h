@@ -0,0 +1,106 @@
+/// @mainpage
+/// @file s21_frame_reader.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_FRAME_READER_H
+#define S21_FRAME_READER_H
+
+#include "../s21_gui_defines.h"
+
+namespace s21 {
+
+/// @brief Асинхронное чтение кадров из framebuffer.
+/// glReadPixels пишет в кольцо буферов GL_PIXEL_PACK_BUFFER и сразу
+/// возвращает управление, буфер отображается в память, когда его fence
+/// сработал, обычно через кадр-два. Пиксели читаются в формате кодировщика
+/// (BGR без выравнивания строк), строки переворачиваются при копировании.
+/// Без буферов пикселей и fence (openGL ниже 3.2 и ES ниже 3.0) кадр
+/// читается синхронно.
+class FrameReader {
+ public:
+  /// @brief Привязка к текущему контексту
+  void initialize();
+  /// @brief Освобождение буферов, контекст должен быть текущим
+  void cleanup();
+
+  /// @brief Запуск чтения кадра. Если кольцо заполнено, самый старый кадр
+  /// дочитывается с ожиданием
+  /// @param framebuffer Идентификатор framebuffer
+  /// @param size Размер кадра в пикселях
+  void request(GLuint framebuffer, const QSize &size);
+  /// @brief Получение очередного прочитанного кадра без ожидания
+  /// @param frame Куда записать кадр
+  /// @return false, если готовых кадров нет
+  bool poll(QImage &frame);
+  /// @brief Получение очередного кадра с ожиданием самого старого чтения
+  /// @param frame Куда записать кадр
+  /// @return false, если не запущено ни одного чтения
+  bool wait(QImage &frame);
+  /// @brief Отмена незавершенных чтений
+  void discard();
+  /// @brief Синхронное чтение кадра
+  /// @param framebuffer Идентификатор framebuffer
+  /// @param size Размер кадра в пикселях
+  /// @return Кадр
+  QImage read(GLuint framebuffer, const QSize &size);
+
+ private:
+  /// @brief Ячейка кольца чтения
+  struct Slot {
+    /// @brief Буфер пикселей
+    GLuint buffer = 0;
+    /// @brief Байт в буфере
+    std::size_t capacity = 0;
+    /// @brief Сигнал завершения glReadPixels
+    GLsync fence = nullptr;
+    /// @brief Размер кадра
+    QSize size;
+  };
+
+  /// @brief Байт в строке кадра
+  /// @param width Ширина кадра
+  /// @return Байт без выравнивания
+  std::size_t rowBytes(int width) const;
+  /// @brief glReadPixels текущего framebuffer без выравнивания строк
+  /// @param framebuffer Идентификатор framebuffer
+  /// @param size Размер кадра
+  /// @param pixels Адрес в памяти или смещение в буфере пикселей
+  void readPixels(GLuint framebuffer, const QSize &size, void *pixels);
+  /// @brief Копирование пикселей в изображение с переворотом строк
+  /// @param pixels Пиксели снизу вверх
+  /// @param size Размер кадра
+  /// @return Изображение сверху вниз
+  QImage toImage(const uchar *pixels, const QSize &size) const;
+  /// @brief Отображение самого старого буфера и перенос кадра в готовые
+  /// @param wait Ждать завершения чтения
+  /// @return false, если ждать не разрешено и чтение не завершено
+  bool collect(bool wait);
+
+  /// @brief Функции openGL
+  QOpenGLExtraFunctions *gl = nullptr;
+  /// @brief Доступны буферы пикселей и fence
+  bool pixelBuffers = false;
+  /// @brief Формат пикселей glReadPixels
+  GLenum pixelFormat = GL_RGBA;
+  /// @brief Формат изображения
+  QImage::Format imageFormat = QImage::Format_RGBA8888;
+  /// @brief Байт на пиксель
+  int pixelBytes = 4;
+  /// @brief Кольцо буферов
+  Slot slots[READBACK_BUFFERS];
+  /// @brief Кол-во запущенных чтений
+  std::size_t requested = 0;
+  /// @brief Кол-во завершенных чтений
+  std::size_t collected = 0;
+  /// @brief Прочитанные кадры
+  std::deque<QImage> ready;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
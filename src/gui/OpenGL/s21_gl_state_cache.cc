@@ -0,0 +1,70 @@
+#include "s21_gl_state_cache.h"
+
+namespace s21 {
+
+void GLStateCache::initialize(QOpenGLExtraFunctions *functions) {
+  gl = functions;
+  invalidate();
+}
+
+void GLStateCache::invalidate() {
+  program = kUnknown;
+  vertexArray = kUnknown;
+  arrayBuffer = kUnknown;
+  elementBuffer = kUnknown;
+  currentLineWidth = -1.0f;
+  currentPointSize = -1.0f;
+  capabilities.clear();
+}
+
+void GLStateCache::useProgram(GLuint newProgram) {
+  if (program != newProgram) {
+    gl->glUseProgram(newProgram);
+    program = newProgram;
+  }
+}
+
+void GLStateCache::bindVertexArray(GLuint vao) {
+  if (vertexArray != vao) {
+    gl->glBindVertexArray(vao);
+    vertexArray = vao;
+    elementBuffer = kUnknown;
+  }
+}
+
+void GLStateCache::bindBuffer(GLenum target, GLuint buffer) {
+  GLuint &current =
+      target == GL_ELEMENT_ARRAY_BUFFER ? elementBuffer : arrayBuffer;
+  if (current != buffer) {
+    gl->glBindBuffer(target, buffer);
+    current = buffer;
+  }
+}
+
+void GLStateCache::setEnabled(GLenum capability, bool enabled) {
+  auto it = capabilities.find(capability);
+  if (it == capabilities.end() || it->second != enabled) {
+    if (enabled) {
+      gl->glEnable(capability);
+    } else {
+      gl->glDisable(capability);
+    }
+    capabilities[capability] = enabled;
+  }
+}
+
+void GLStateCache::lineWidth(float width) {
+  if (currentLineWidth != width) {
+    gl->glLineWidth(width);
+    currentLineWidth = width;
+  }
+}
+
+void GLStateCache::pointSize(float size) {
+  if (currentPointSize != size) {
+    glPointSize(size);
+    currentPointSize = size;
+  }
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,73 @@
+/// @mainpage
+/// @file s21_gl_state_cache.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_GL_STATE_CACHE_H
+#define S21_GL_STATE_CACHE_H
+
+#include "../s21_gui_defines.h"
+
+namespace s21 {
+
+/// @brief Кэш состояния openGL, пропускающий повторные привязки.
+/// Кэш сбрасывается в начале каждого кадра, так как контекст может
+/// использоваться и самим Qt.
+class GLStateCache {
+ public:
+  /// @brief Привязка к функциям текущего контекста
+  /// @param functions Указатель на функции openGL
+  void initialize(QOpenGLExtraFunctions *functions);
+  /// @brief Сброс известного состояния
+  void invalidate();
+
+  /// @brief Установка шейдерной программы
+  /// @param program Идентификатор программы
+  void useProgram(GLuint program);
+  /// @brief Привязка объекта вершинного массива
+  /// @param vao Идентификатор VAO
+  void bindVertexArray(GLuint vao);
+  /// @brief Привязка буфера
+  /// @param target GL_ARRAY_BUFFER или GL_ELEMENT_ARRAY_BUFFER
+  /// @param buffer Идентификатор буфера
+  void bindBuffer(GLenum target, GLuint buffer);
+  /// @brief Включение или выключение возможности openGL
+  /// @param capability Возможность, например GL_POINT_SMOOTH
+  /// @param enabled Включить
+  void setEnabled(GLenum capability, bool enabled);
+  /// @brief Установка толщины линий
+  /// @param width Толщина
+  void lineWidth(float width);
+  /// @brief Установка размера точек
+  /// @param size Размер
+  void pointSize(float size);
+
+ private:
+  /// @brief Значение неизвестного состояния
+  static constexpr GLuint kUnknown = ~0u;
+
+  /// @brief Функции openGL
+  QOpenGLExtraFunctions *gl = nullptr;
+  /// @brief Текущая программа
+  GLuint program = kUnknown;
+  /// @brief Текущий VAO
+  GLuint vertexArray = kUnknown;
+  /// @brief Текущий буфер вершин
+  GLuint arrayBuffer = kUnknown;
+  /// @brief Текущий буфер индексов
+  GLuint elementBuffer = kUnknown;
+  /// @brief Текущая толщина линий
+  float currentLineWidth = -1.0f;
+  /// @brief Текущий размер точек
+  float currentPointSize = -1.0f;
+  /// @brief Известные состояния возможностей openGL
+  std::map<GLenum, bool> capabilities;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
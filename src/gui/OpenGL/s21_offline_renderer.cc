@@ -0,0 +1,112 @@
+#include "s21_offline_renderer.h"
+
+namespace s21 {
+
+OfflineRenderer::OfflineRenderer(const RenderSettingsData &renderSettings,
+                                 const Animation &renderAnimation,
+                                 const QSize &frameSize, int framesPerSecond)
+    : settings(renderSettings),
+      animation(renderAnimation),
+      size(frameSize.expandedTo(QSize(1, 1))),
+      fps(std::max(1, framesPerSecond)) {
+  surface = new QOffscreenSurface();
+  surface->setFormat(QSurfaceFormat::defaultFormat());
+  surface->create();
+
+  context = new QOpenGLContext();
+  context->setFormat(QSurfaceFormat::defaultFormat());
+  if (!context->create()) {
+    qDebug() << "Не удалось создать контекст внеэкранной отрисовки";
+  }
+  context->moveToThread(this);
+}
+
+OfflineRenderer::~OfflineRenderer() {
+  requestInterruption();
+  wait();
+  delete context;
+  context = nullptr;
+  surface->destroy();
+  delete surface;
+  surface = nullptr;
+}
+
+void OfflineRenderer::addJob(const OfflineJob_t &job) { jobs.push_back(job); }
+
+std::size_t OfflineRenderer::frameCount() const {
+  return animation.frameCount(fps);
+}
+
+std::size_t OfflineRenderer::jobCount() const { return jobs.size(); }
+
+void OfflineRenderer::run() {
+  context->makeCurrent(surface);
+  for (std::size_t i = 0; i < jobs.size() && !isInterruptionRequested();
+       ++i) {
+    emit jobFinished(static_cast<int>(i), renderJob(static_cast<int>(i)));
+  }
+  context->doneCurrent();
+  context->moveToThread(QCoreApplication::instance()->thread());
+}
+
+Status_e OfflineRenderer::renderJob(int index) {
+  Controller controller;
+  controller.setPointCloudResolution(
+      std::max(0, settings.pointCloudResolution));
+  Status_e status = controller.loadModel(
+      jobs[index].model.toStdString(), settings.loadOptions());
+  if (status != Status_e::OK) return status;
+
+  Renderer renderer;
+  renderer.initialize();
+  FrameReader reader;
+  reader.initialize();
+  QOpenGLFramebufferObject buffer(
+      size, QOpenGLFramebufferObject::CombinedDepthStencil);
+  VideoEncoder encoder(jobs[index].video, fps);
+  encoder.start();
+
+  ViewState state;
+  state.size = size;
+  state.settings = settings;
+  renderer.uploadModel(controller.getDisplayVertices(),
+                       controller.getEdgeStrips());
+  while (renderer.prepare(state, controller)) {
+  }
+
+  std::size_t frames = frameCount();
+  int pushed = 0;
+  QImage frame;
+  for (std::size_t n = 0; n < frames && !isInterruptionRequested(); ++n) {
+    controller.clearTransformation();
+    controller.applyTransformations(
+        animation.getSteps(static_cast<float>(n) / fps));
+    state.transformation = Renderer::toQMatrix(controller.getTransformation());
+    renderer.prepare(state, controller);
+    buffer.bind();
+    renderer.render(state);
+    reader.request(buffer.handle(), size);
+    while (reader.poll(frame)) {
+      pushFrame(encoder, frame);
+      emit frameRendered(index, ++pushed);
+    }
+  }
+  while (!isInterruptionRequested() && reader.wait(frame)) {
+    pushFrame(encoder, frame);
+    emit frameRendered(index, ++pushed);
+  }
+  buffer.release();
+  reader.cleanup();
+  renderer.cleanup();
+  encoder.finish();
+  encoder.wait();
+  return status;
+}
+
+void OfflineRenderer::pushFrame(VideoEncoder &encoder, const QImage &frame) {
+  while (!encoder.pushFrame(frame) && !isInterruptionRequested()) {
+    QThread::msleep(1);
+  }
+}
+
+}  // namespace s21
\ No newline at end of file
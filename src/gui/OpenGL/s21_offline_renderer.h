@@ -0,0 +1,100 @@
+/// @mainpage
+/// @file s21_offline_renderer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_OFFLINE_RENDERER_H
+#define S21_OFFLINE_RENDERER_H
+
+#include "../s21_gui_defines.h"
+#include "../s21_render_settings.h"
+#include "../video/s21_video_encoder.h"
+#include "s21_frame_reader.h"
+#include "s21_renderer.h"
+
+namespace s21 {
+
+/// @brief Задание внеэкранной отрисовки
+struct OfflineJob_t {
+  /// @brief Путь к модели
+  QString model;
+  /// @brief Путь к видео
+  QString video;
+};
+
+/// @brief Поток внеэкранной отрисовки анимаций в видео.
+/// Каждая модель загружается в свой контроллер, кадр n рисуется с
+/// трансформацией анимации в момент n / fps во внеэкранный буфер заданного
+/// размера и передается кодировщику. Кадры не зависят от таймеров и скорости
+/// машины: поток рисует так быстро, как успевает кодировщик, и ждет его при
+/// заполненной очереди, кадры не теряются.
+class OfflineRenderer : public QThread {
+  Q_OBJECT
+ public:
+  /// @brief Конструктор, вызывается в потоке GUI
+  /// @param settings Настройки отрисовки
+  /// @param animation Анимация
+  /// @param size Размер кадра в пикселях
+  /// @param fps Кадров в секунду
+  OfflineRenderer(const RenderSettingsData &settings,
+                  const Animation &animation, const QSize &size, int fps);
+  /// @brief Деструктор, прерывает отрисовку и останавливает поток
+  ~OfflineRenderer();
+
+  /// @brief Добавление задания, вызывается до start()
+  /// @param job Задание
+  void addJob(const OfflineJob_t &job);
+  /// @brief Кол-во кадров в одном видео
+  /// @return Кол-во кадров
+  std::size_t frameCount() const;
+  /// @brief Кол-во заданий
+  /// @return Кол-во заданий
+  std::size_t jobCount() const;
+
+ signals:
+  /// @brief Сигнал о переданном кодировщику кадре
+  /// @param job Номер задания
+  /// @param frame Кол-во кадров задания, переданных кодировщику
+  void frameRendered(int job, int frame);
+  /// @brief Сигнал о завершении задания
+  /// @param job Номер задания
+  /// @param status Статус загрузки модели
+  void jobFinished(int job, Status_e status);
+
+ protected:
+  /// @brief Цикл отрисовки заданий
+  void run() override;
+
+ private:
+  /// @brief Отрисовка одного задания
+  /// @param index Номер задания
+  /// @return Статус загрузки модели
+  Status_e renderJob(int index);
+  /// @brief Передача кадра кодировщику с ожиданием места в очереди
+  /// @param encoder Кодировщик
+  /// @param frame Кадр
+  void pushFrame(VideoEncoder &encoder, const QImage &frame);
+
+  /// @brief Контекст openGL потока
+  QOpenGLContext *context = nullptr;
+  /// @brief Внеэкранная поверхность для контекста
+  QOffscreenSurface *surface = nullptr;
+  /// @brief Настройки отрисовки
+  RenderSettingsData settings;
+  /// @brief Анимация
+  Animation animation;
+  /// @brief Размер кадра
+  QSize size;
+  /// @brief Кадров в секунду
+  int fps = FPS;
+  /// @brief Задания
+  std::vector<OfflineJob_t> jobs;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -0,0 +1,176 @@
+#include "s21_render_thread.h"
+
+namespace s21 {
+
+RenderThread::RenderThread(QOpenGLContext *shareContext, Controller *ctrl)
+    : controller(ctrl) {
+  surface = new QOffscreenSurface();
+  surface->setFormat(shareContext->format());
+  surface->create();
+
+  context = new QOpenGLContext();
+  context->setFormat(shareContext->format());
+  context->setShareContext(shareContext);
+  if (!context->create()) {
+    qDebug() << "Не удалось создать контекст потока отрисовки";
+  }
+  context->moveToThread(this);
+}
+
+RenderThread::~RenderThread() {
+  stop();
+  wait();
+  delete context;
+  context = nullptr;
+  surface->destroy();
+  delete surface;
+  surface = nullptr;
+}
+
+void RenderThread::postState(const ViewState &state) {
+  QMutexLocker locker(&stateMutex);
+  pendingState = state;
+  stateDirty = true;
+  stateCondition.wakeOne();
+}
+
+void RenderThread::requestUpload() {
+  QMutexLocker locker(&stateMutex);
+  uploadPending = true;
+  stateCondition.wakeOne();
+}
+
+void RenderThread::requestTiled(const ViewState &state, const QSize &size,
+                                const QString &path) {
+  QMutexLocker locker(&stateMutex);
+  tiledState = state;
+  tiledSize = size;
+  tiledPath = path;
+  tiledPending = true;
+  stateCondition.wakeOne();
+}
+
+void RenderThread::stop() {
+  QMutexLocker locker(&stateMutex);
+  exiting = true;
+  stateCondition.wakeOne();
+}
+
+QMutex &RenderThread::geometryMutex() { return modelMutex; }
+
+bool RenderThread::needsGeometry(const ViewState &state) const {
+  return renderer.needsGeometry(state);
+}
+
+void RenderThread::drawFrontFrame(QOpenGLTextureBlitter &blitter,
+                                  const QRect &viewport) {
+  QMutexLocker locker(&frameMutex);
+  if (frontBuffer) {
+    blitter.bind();
+    blitter.blit(frontBuffer->texture(),
+                 QOpenGLTextureBlitter::targetTransform(QRectF(viewport),
+                                                        viewport),
+                 QOpenGLTextureBlitter::OriginBottomLeft);
+    blitter.release();
+  }
+}
+
+void RenderThread::run() {
+  context->makeCurrent(surface);
+  renderer.initialize();
+
+  bool running = true;
+  while (running) {
+    bool upload = false;
+    bool tiled = false;
+    ViewState tiledView;
+    QSize imageSize;
+    QString imagePath;
+    {
+      QMutexLocker locker(&stateMutex);
+      while (!exiting && !stateDirty && !uploadPending && !tiledPending &&
+             !renderer.isUploading()) {
+        stateCondition.wait(&stateMutex);
+      }
+      running = !exiting;
+      currentState = pendingState;
+      upload = uploadPending;
+      stateDirty = false;
+      uploadPending = false;
+      tiled = tiledPending;
+      tiledView = tiledState;
+      imageSize = tiledSize;
+      imagePath = tiledPath;
+      tiledPending = false;
+    }
+    if (running) {
+      {
+        QMutexLocker locker(&modelMutex);
+        if (upload) {
+          std::size_t strips = currentState.settings.loadOptions().edges
+                                   ? controller->getEdgeStrips().size()
+                                   : 0;
+          renderer.beginUpload(controller->getDisplayVertices().size(),
+                               strips);
+        }
+        renderer.prepare(currentState, *controller);
+        if (currentState.settings.gpuResident && renderer.isResident() &&
+            controller->isGeometryLoaded()) {
+          quint64 before = residentMemory();
+          controller->releaseGeometry();
+          emit geometryReleased(before, residentMemory());
+        }
+      }
+      resizeBuffers(currentState.size);
+      QElapsedTimer frameTimer;
+      frameTimer.start();
+      backBuffer->bind();
+      renderer.render(currentState);
+      backBuffer->release();
+      double cpuTime = frameTimer.nsecsElapsed() / 1e6;
+      context->functions()->glFinish();
+      {
+        QMutexLocker locker(&frameMutex);
+        std::swap(frontBuffer, backBuffer);
+      }
+      emit frameReady(cpuTime, currentState.inputTime,
+                      renderer.edgeFragments());
+      if (tiled) {
+        bool saved = TiledRenderer(renderer).render(tiledView, imageSize,
+                                                    imagePath);
+        emit tiledSaved(imagePath, saved);
+      }
+    }
+  }
+
+  releaseResources();
+  context->doneCurrent();
+  context->moveToThread(QCoreApplication::instance()->thread());
+}
+
+void RenderThread::resizeBuffers(const QSize &size) {
+  if (backBuffer && backBuffer->size() != size) {
+    delete backBuffer;
+    backBuffer = nullptr;
+  }
+  if (!backBuffer) {
+    backBuffer = new QOpenGLFramebufferObject(
+        size, QOpenGLFramebufferObject::CombinedDepthStencil);
+    QOpenGLFunctions *functions = context->functions();
+    functions->glBindTexture(GL_TEXTURE_2D, backBuffer->texture());
+    functions->glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                               GL_LINEAR);
+    functions->glBindTexture(GL_TEXTURE_2D, 0);
+  }
+}
+
+void RenderThread::releaseResources() {
+  renderer.cleanup();
+  QMutexLocker locker(&frameMutex);
+  delete frontBuffer;
+  frontBuffer = nullptr;
+  delete backBuffer;
+  backBuffer = nullptr;
+}
+
+}  // namespace s21
\ No newline at end of file
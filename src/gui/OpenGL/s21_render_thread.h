@@ -0,0 +1,131 @@
+/// @mainpage
+/// @file s21_render_thread.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_RENDER_THREAD_H
+#define S21_RENDER_THREAD_H
+
+#include "../s21_gui_defines.h"
+#include "s21_renderer.h"
+#include "s21_tiled_renderer.h"
+
+namespace s21 {
+
+/// @brief Поток отрисовки со своим контекстом openGL.
+/// Поток GUI только публикует состояние сцены, поток отрисовки забирает
+/// последнее опубликованное состояние и рисует его во внеэкранный буфер.
+/// Готовые кадры меняются местами (двойная буферизация), виджет лишь выводит
+/// последний готовый кадр.
+class RenderThread : public QThread {
+  Q_OBJECT
+ public:
+  /// @brief Конструктор, вызывается в потоке GUI
+  /// @param shareContext Контекст виджета, с которым разделяются текстуры
+  /// @param ctrl Указатель на контроллер с геометрией модели
+  RenderThread(QOpenGLContext *shareContext, Controller *ctrl);
+  /// @brief Деструктор, останавливает поток
+  ~RenderThread();
+
+  /// @brief Публикация нового состояния сцены, вызывается из потока GUI
+  /// @param state Состояние сцены
+  void postState(const ViewState &state);
+  /// @brief Запрос загрузки геометрии модели в поток отрисовки
+  void requestUpload();
+  /// @brief Запрос отрисовки изображения по плиткам в потоке отрисовки
+  /// @param state Состояние сцены в окне
+  /// @param size Размер изображения
+  /// @param path Путь к файлу PNG
+  void requestTiled(const ViewState &state, const QSize &size,
+                    const QString &path);
+  /// @brief Остановка потока отрисовки
+  void stop();
+  /// @brief Мьютекс геометрии модели, удерживается на время ее загрузки
+  /// @return Ссылка на мьютекс
+  QMutex &geometryMutex();
+  /// @brief Нужны ли состоянию буферы, которых нет в видеопамяти потока.
+  /// Вызывается под geometryMutex
+  /// @param state Состояние сцены
+  /// @return true, если для кадра не хватает геометрии модели
+  bool needsGeometry(const ViewState &state) const;
+  /// @brief Вывод последнего готового кадра в текущий framebuffer
+  /// @param blitter Ссылка на инициализированный блиттер
+  /// @param viewport Область вывода
+  void drawFrontFrame(QOpenGLTextureBlitter &blitter, const QRect &viewport);
+
+ signals:
+  /// @brief Сигнал о готовности нового кадра
+  /// @param cpuTime Время процессора, затраченное на кадр, в мс
+  /// @param inputTime Время ввода, учтенного в кадре, из ViewState
+  /// @param edgeFragments Кол-во фрагментов ребер из Renderer
+  void frameReady(double cpuTime, qint64 inputTime, quint64 edgeFragments);
+  /// @brief Сигнал об освобождении геометрии в оперативной памяти
+  /// @param before Резидентная память до освобождения, байт
+  /// @param after Резидентная память после освобождения, байт
+  void geometryReleased(quint64 before, quint64 after);
+  /// @brief Сигнал о записи изображения, отрисованного по плиткам
+  /// @param path Путь к файлу
+  /// @param saved Файл записан
+  void tiledSaved(const QString &path, bool saved);
+
+ protected:
+  /// @brief Цикл отрисовки
+  void run() override;
+
+ private:
+  /// @brief Пересоздает внеэкранные буферы при изменении размера
+  /// @param size Новый размер в пикселях устройства
+  void resizeBuffers(const QSize &size);
+  /// @brief Освобождение ресурсов openGL потока
+  void releaseResources();
+
+  /// @brief Контекст openGL потока отрисовки
+  QOpenGLContext *context = nullptr;
+  /// @brief Внеэкранная поверхность для контекста
+  QOffscreenSurface *surface = nullptr;
+  /// @brief Контроллер с геометрией модели
+  Controller *controller = nullptr;
+  /// @brief Объект отрисовки сцены
+  Renderer renderer;
+
+  /// @brief Мьютекс блока состояния
+  QMutex stateMutex;
+  /// @brief Условие появления нового состояния
+  QWaitCondition stateCondition;
+  /// @brief Состояние, опубликованное потоком GUI
+  ViewState pendingState;
+  /// @brief Состояние, которое рисует поток отрисовки
+  ViewState currentState;
+  /// @brief Есть неотрисованное состояние
+  bool stateDirty = false;
+  /// @brief Требуется загрузка геометрии
+  bool uploadPending = false;
+  /// @brief Поток должен завершиться
+  bool exiting = false;
+  /// @brief Запрошено изображение по плиткам
+  bool tiledPending = false;
+  /// @brief Состояние сцены для изображения по плиткам
+  ViewState tiledState;
+  /// @brief Размер изображения по плиткам
+  QSize tiledSize;
+  /// @brief Путь к изображению по плиткам
+  QString tiledPath;
+
+  /// @brief Мьютекс геометрии модели
+  QMutex modelMutex;
+
+  /// @brief Мьютекс готовых кадров
+  QMutex frameMutex;
+  /// @brief Последний готовый кадр
+  QOpenGLFramebufferObject *frontBuffer = nullptr;
+  /// @brief Кадр, в который идет отрисовка
+  QOpenGLFramebufferObject *backBuffer = nullptr;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
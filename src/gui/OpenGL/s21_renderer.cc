@@ -0,0 +1,867 @@
+#include "s21_renderer.h"
+
+namespace s21 {
+
+QSurfaceFormat Renderer::preferredFormat() {
+  QSurfaceFormat format;
+  format.setVersion(3, 3);
+  format.setProfile(QSurfaceFormat::CoreProfile);
+  QOpenGLContext context;
+  context.setFormat(format);
+  bool supported = context.create() &&
+                   context.format().version() >= format.version() &&
+                   context.format().profile() == format.profile();
+  if (qEnvironmentVariableIsSet("S21_LEGACY_GL") || !supported) {
+    format.setVersion(2, 1);
+    format.setProfile(QSurfaceFormat::NoProfile);
+  }
+  return format;
+}
+
+QMatrix4x4 Renderer::toQMatrix(const Matrix &m) {
+  return QMatrix4x4(m[0][0], m[0][1], m[0][2], m[0][3], m[1][0], m[1][1],
+                    m[1][2], m[1][3], m[2][0], m[2][1], m[2][2], m[2][3],
+                    m[3][0], m[3][1], m[3][2], m[3][3]);
+}
+
+void Renderer::initialize() {
+  initializeOpenGLFunctions();
+  QSurfaceFormat format = QOpenGLContext::currentContext()->format();
+  coreProfile = format.profile() == QSurfaceFormat::CoreProfile &&
+                format.version() >= qMakePair(3, 3);
+  stateCache.initialize(this);
+  multiDrawElements = reinterpret_cast<MultiDrawElements_t>(
+      QOpenGLContext::currentContext()->getProcAddress("glMultiDrawElements"));
+  initializePrimitiveRestart();
+
+  initializeShader();
+
+  glEnable(GL_DEPTH_TEST);
+  glGenQueries(2, fragmentQueries);
+}
+
+void Renderer::initializePrimitiveRestart() {
+  QOpenGLContext *context = QOpenGLContext::currentContext();
+  QSurfaceFormat format = context->format();
+  primitiveRestart = false;
+  if (context->isOpenGLES()) {
+    primitiveRestart = format.majorVersion() >= 3;
+    if (primitiveRestart) glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+  } else if (format.version() >= qMakePair(3, 1)) {
+    PrimitiveRestartIndex_t restartIndex =
+        reinterpret_cast<PrimitiveRestartIndex_t>(
+            context->getProcAddress("glPrimitiveRestartIndex"));
+    if (restartIndex) {
+      restartIndex(STRIP_RESTART);
+      glEnable(GL_PRIMITIVE_RESTART);
+      primitiveRestart = true;
+    }
+  }
+}
+
+void Renderer::cleanup() {
+  for (QOpenGLShaderProgram *&variant : variants) {
+    delete variant;
+    variant = nullptr;
+  }
+  if (surfaceProgram) {
+    delete surfaceProgram;
+    surfaceProgram = nullptr;
+  }
+  if (wireProgram) {
+    delete wireProgram;
+    wireProgram = nullptr;
+  }
+  clearGeometry();
+  if (surfaceVao.isCreated()) surfaceVao.destroy();
+  if (fragmentQueries[0] != 0) {
+    glDeleteQueries(2, fragmentQueries);
+    fragmentQueries[0] = fragmentQueries[1] = 0;
+  }
+  queryPending[0] = queryPending[1] = false;
+  if (vao.isCreated()) vao.destroy();
+}
+
+void Renderer::clearGeometry() {
+  deleteSurface();
+  deleteBuffer(VBO);
+  deleteBuffer(EBO);
+  deleteBuffer(uploadVBO);
+  verticesCount = 0;
+  edgeIndices = 0;
+  clusters.clear();
+  clustersCurrent = false;
+  stripCounts.clear();
+  stripOffsets.clear();
+  uploading = false;
+  stateCache.invalidate();
+}
+
+void Renderer::deleteBuffer(GLuint &buffer) {
+  if (buffer != 0) {
+    glDeleteBuffers(1, &buffer);
+    buffer = 0;
+  }
+}
+
+bool Renderer::isCoreProfile() const { return coreProfile; }
+
+QByteArray Renderer::shaderSource(const QString &path,
+                                  QOpenGLShader::ShaderType type,
+                                  const QByteArray &defines) const {
+  QByteArray header;
+  if (coreProfile) {
+    header = "#version 330 core\n";
+    if (type == QOpenGLShader::Vertex) {
+      header += "#define attribute in\n#define varying out\n";
+    } else if (type == QOpenGLShader::Fragment) {
+      header +=
+          "#define varying in\nout vec4 fragColor;\n"
+          "#define FRAG_COLOR fragColor\n";
+    }
+  } else {
+    header = "#version 120\n#define FRAG_COLOR gl_FragColor\n";
+  }
+  header += defines;
+  QFile file(path);
+  if (file.open(QIODevice::ReadOnly)) {
+    header += file.readAll();
+  }
+  return header;
+}
+
+QOpenGLShaderProgram *Renderer::createProgram(
+    const QString &vertexPath, const QString &fragmentPath,
+    const QString &geometryPath, const QByteArray &defines) const {
+  QOpenGLShaderProgram *program = new QOpenGLShaderProgram();
+  program->addCacheableShaderFromSourceCode(
+      QOpenGLShader::Vertex,
+      shaderSource(vertexPath, QOpenGLShader::Vertex, defines));
+  if (!geometryPath.isEmpty()) {
+    program->addCacheableShaderFromSourceCode(
+        QOpenGLShader::Geometry,
+        shaderSource(geometryPath, QOpenGLShader::Geometry, defines));
+  }
+  program->addCacheableShaderFromSourceCode(
+      QOpenGLShader::Fragment,
+      shaderSource(fragmentPath, QOpenGLShader::Fragment, defines));
+  program->bindAttributeLocation("vertex_pos", ATTRIBUTE_POSITION);
+  program->bindAttributeLocation("vertex_normal", ATTRIBUTE_NORMAL);
+  if (!program->link()) {
+    qDebug() << "Ошибка связывания шейдерной программы:" << program->log();
+  }
+  return program;
+}
+
+void Renderer::initializeShader() {
+  surfaceProgram = createProgram(":/shaders/surface_vertex_shader.glsl",
+                                 ":/shaders/surface_fragment_shader.glsl");
+  surfaceLocations.mvpMatrix = surfaceProgram->uniformLocation("mvp_matrix");
+  surfaceLocations.modelMatrix =
+      surfaceProgram->uniformLocation("model_matrix");
+  surfaceLocations.color = surfaceProgram->uniformLocation("color");
+
+  if (coreProfile) {
+    wireProgram = createProgram(":/shaders/wire_vertex_shader.glsl",
+                                ":/shaders/wire_fragment_shader.glsl",
+                                ":/shaders/wire_geometry_shader.glsl");
+    wireLocations.mvpMatrix = wireProgram->uniformLocation("mvp_matrix");
+    wireLocations.color = wireProgram->uniformLocation("color");
+    wireLocations.lineWidth = wireProgram->uniformLocation("lineWidth");
+    wireLocations.edgeMasks = wireProgram->uniformLocation("edgeMasks");
+  }
+}
+
+void Renderer::uploadModel(const std::vector<Vertex_t> &vertices,
+                           const std::vector<unsigned int> &indices) {
+  beginUpload(vertices.size(), indices.size());
+  while (uploadSlice(vertices, indices)) {
+  }
+}
+
+void Renderer::beginUpload(std::size_t vertices, std::size_t indices) {
+  if (vertices == 0) {
+    clearGeometry();
+    return;
+  }
+  deleteBuffer(uploadVBO);
+  uploadVertices = vertices;
+  uploadIndices = indices;
+  uploadedVertexBytes = 0;
+  uploadedEdgeBytes = 0;
+
+  glGenBuffers(1, &uploadVBO);
+  glBindBuffer(GL_ARRAY_BUFFER, uploadVBO);
+  glBufferData(GL_ARRAY_BUFFER, vertices * sizeof(Vertex_t), nullptr,
+               GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  stateCache.invalidate();
+  uploading = true;
+}
+
+bool Renderer::uploadSlice(const std::vector<Vertex_t> &vertices,
+                           const std::vector<unsigned int> &indices) {
+  if (!uploading) return false;
+  if (vertices.size() != uploadVertices || indices.size() != uploadIndices) {
+    abortUpload();
+    return false;
+  }
+  std::size_t vertexBytes = uploadVertices * sizeof(Vertex_t);
+  std::size_t edgeBytes = uploadIndices * sizeof(unsigned int);
+  if (uploadVBO != 0) {
+    uploadBufferSlice(uploadVBO, vertices.data(), vertexBytes,
+                      uploadedVertexBytes);
+    if (uploadedVertexBytes == vertexBytes) swapUploadedBuffers();
+  } else if (edgesWanted && uploadIndices > 0) {
+    if (EBO == 0) allocateEdges(uploadIndices);
+    uploadBufferSlice(EBO, indices.data(), edgeBytes, uploadedEdgeBytes);
+    edgeIndices = uploadedEdgeBytes / sizeof(unsigned int);
+  } else {
+    uploadedEdgeBytes = edgeBytes;
+  }
+  if (uploadVBO == 0 && uploadedEdgeBytes == edgeBytes) uploading = false;
+  stateCache.invalidate();
+  return uploading;
+}
+
+void Renderer::abortUpload() {
+  if (uploadVBO == 0) {
+    deleteBuffer(EBO);
+    edgeIndices = 0;
+    clusters.clear();
+    clustersCurrent = false;
+  }
+  deleteBuffer(uploadVBO);
+  uploading = false;
+  stateCache.invalidate();
+}
+
+bool Renderer::isUploading() const { return uploading || surfaceUploading; }
+
+bool Renderer::prepare(const ViewState &state, const Controller &controller) {
+  edgesWanted = !usesTriangleWire(state);
+  if (uploading) {
+    const std::vector<unsigned int> noStrips;
+    uploadSlice(controller.getDisplayVertices(),
+                uploadIndices ? controller.getEdgeStrips() : noStrips);
+    if (EBO != 0 && stripCounts.empty()) updateStrips(controller);
+  } else if (surfaceUploading) {
+    uploadSurfaceSlice(controller);
+  }
+  if (!isUploading()) pointCloud = controller.isPointCloud();
+  if (!isUploading() && VBO != 0 && controller.isGeometryLoaded() &&
+      controller.getInfo().displayed == verticesCount) {
+    if (needsSurface(state)) beginSurface(controller);
+    edgesWanted = !usesTriangleWire(state);
+    if (edgesWanted && EBO == 0) {
+      beginEdges(controller.getEdgeStrips().size());
+    }
+    if (EBO != 0 && !clustersCurrent && !uploading &&
+        edgeIndices == uploadIndices) {
+      updateClusters(controller);
+    }
+  }
+  if (!isUploading() && !edgesWanted && EBO != 0) {
+    deleteBuffer(EBO);
+    edgeIndices = 0;
+    clusters.clear();
+    clustersCurrent = false;
+  }
+  return isUploading();
+}
+
+void Renderer::updateClusters(const Controller &controller) {
+  clusters = controller.getEdgeClusters();
+  clustersCurrent = true;
+}
+
+void Renderer::updateStrips(const Controller &controller) {
+  stripCounts.clear();
+  stripOffsets.clear();
+  if (!primitiveRestart) {
+    const std::vector<std::size_t> &starts = controller.getEdgeStripStarts();
+    for (std::size_t i = 0; i + 1 < starts.size(); ++i) {
+      stripCounts.push_back(
+          static_cast<GLsizei>(starts[i + 1] - starts[i] - 1));
+      stripOffsets.push_back(
+          reinterpret_cast<const void *>(starts[i] * sizeof(unsigned int)));
+    }
+  }
+}
+
+std::size_t Renderer::uploadedStrips() const {
+  std::size_t low = 0;
+  std::size_t high = stripCounts.size();
+  while (low < high) {
+    std::size_t middle = (low + high) / 2;
+    std::size_t end =
+        reinterpret_cast<std::uintptr_t>(stripOffsets[middle]) /
+            sizeof(unsigned int) +
+        stripCounts[middle];
+    if (end <= edgeIndices) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+void Renderer::allocateEdges(std::size_t count) {
+  deleteBuffer(EBO);
+  glGenBuffers(1, &EBO);
+  glBindBuffer(GL_ARRAY_BUFFER, EBO);
+  glBufferData(GL_ARRAY_BUFFER, count * sizeof(unsigned int), nullptr,
+               GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  if (coreProfile) {
+    vao.bind();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    vao.release();
+  }
+  edgeIndices = 0;
+  clusters.clear();
+  clustersCurrent = false;
+  stripCounts.clear();
+  stripOffsets.clear();
+  stateCache.invalidate();
+}
+
+void Renderer::beginEdges(std::size_t count) {
+  allocateEdges(count);
+  uploadVertices = verticesCount;
+  uploadIndices = count;
+  uploadedEdgeBytes = 0;
+  uploading = count > 0;
+}
+
+void Renderer::beginSurface(const Controller &controller) {
+  deleteSurface();
+  const std::vector<Vertex_t> &normals = controller.getNormals();
+  const std::vector<Triangle_t> &triangles = controller.getTriangles();
+  const std::vector<unsigned char> &masks = controller.getEdgeMasks();
+  if (VBO == 0 || normals.size() != verticesCount) return;
+
+  uploadTriangles = triangles.size();
+  uploadMasks = 0;
+  uploadedNormalBytes = uploadedTriangleBytes = uploadedMaskBytes = 0;
+  glGenBuffers(1, &normalVBO);
+  glGenBuffers(1, &triangleEBO);
+  glBindBuffer(GL_ARRAY_BUFFER, normalVBO);
+  glBufferData(GL_ARRAY_BUFFER, normals.size() * sizeof(Vertex_t), nullptr,
+               GL_STATIC_DRAW);
+  glBindBuffer(GL_ARRAY_BUFFER, triangleEBO);
+  glBufferData(GL_ARRAY_BUFFER, uploadTriangles * sizeof(Triangle_t),
+               nullptr, GL_STATIC_DRAW);
+  if (coreProfile) {
+    GLint maxTexels = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+    if (masks.size() <= static_cast<std::size_t>(maxTexels)) {
+      uploadMasks = masks.size();
+      glGenBuffers(1, &maskBuffer);
+      glBindBuffer(GL_ARRAY_BUFFER, maskBuffer);
+      glBufferData(GL_ARRAY_BUFFER, uploadMasks, nullptr, GL_STATIC_DRAW);
+    }
+  }
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  surfaceUploading = true;
+  stateCache.invalidate();
+}
+
+void Renderer::uploadSurfaceSlice(const Controller &controller) {
+  if (!controller.isGeometryLoaded()) {
+    deleteSurface();
+    return;
+  }
+  const std::vector<Vertex_t> &normals = controller.getNormals();
+  const std::vector<Triangle_t> &triangles = controller.getTriangles();
+  const std::vector<unsigned char> &masks = controller.getEdgeMasks();
+  if (normals.size() != verticesCount || triangles.size() != uploadTriangles ||
+      (uploadMasks != 0 && masks.size() != uploadMasks)) {
+    deleteSurface();
+    return;
+  }
+  std::size_t normalBytes = normals.size() * sizeof(Vertex_t);
+  std::size_t triangleBytes = uploadTriangles * sizeof(Triangle_t);
+  if (uploadedNormalBytes < normalBytes) {
+    uploadBufferSlice(normalVBO, normals.data(), normalBytes,
+                      uploadedNormalBytes);
+  } else if (uploadedTriangleBytes < triangleBytes) {
+    uploadBufferSlice(triangleEBO, triangles.data(), triangleBytes,
+                      uploadedTriangleBytes);
+  } else if (uploadedMaskBytes < uploadMasks) {
+    uploadBufferSlice(maskBuffer, masks.data(), uploadMasks,
+                      uploadedMaskBytes);
+  }
+  if (uploadedNormalBytes == normalBytes &&
+      uploadedTriangleBytes == triangleBytes &&
+      uploadedMaskBytes == uploadMasks) {
+    finishSurface();
+  }
+  stateCache.invalidate();
+}
+
+void Renderer::finishSurface() {
+  trianglesCount = uploadTriangles;
+  surfaceUploading = false;
+  if (coreProfile) {
+    if (!surfaceVao.isCreated()) surfaceVao.create();
+    surfaceVao.bind();
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glVertexAttribPointer(ATTRIBUTE_POSITION, 3, GL_FLOAT, GL_FALSE,
+                          sizeof(Vertex_t), nullptr);
+    glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+    glBindBuffer(GL_ARRAY_BUFFER, normalVBO);
+    glVertexAttribPointer(ATTRIBUTE_NORMAL, 3, GL_FLOAT, GL_FALSE,
+                          sizeof(Vertex_t), nullptr);
+    glEnableVertexAttribArray(ATTRIBUTE_NORMAL);
+    surfaceVao.release();
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+  if (maskBuffer != 0) {
+    glGenTextures(1, &maskTexture);
+    glBindTexture(GL_TEXTURE_BUFFER, maskTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R8UI, maskBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+  }
+}
+
+bool Renderer::isResident() const { return VBO != 0 && !isUploading(); }
+
+bool Renderer::needsGeometry(const ViewState &state) const {
+  bool edges = !usesTriangleWire(state) && (EBO == 0 || !clustersCurrent);
+  return VBO != 0 && !isUploading() && (needsSurface(state) || edges);
+}
+
+bool Renderer::hasSurface() const { return triangleEBO != 0; }
+
+bool Renderer::needsSurface(const ViewState &state) const {
+  return (state.settings.displayMode != DisplayMode_e::Wireframe_e ||
+          state.settings.edgesStyle == EdgesStyle_e::HiddenLineEdges_e ||
+          usesTriangleWire(state)) &&
+         VBO != 0 && !isUploading() && !hasSurface();
+}
+
+bool Renderer::usesTriangleWire(const ViewState &state) const {
+  return wireProgram && wireProgram->isLinked() &&
+         state.settings.edgesStyle == EdgesStyle_e::TriangleEdges_e &&
+         (!hasSurface() || maskBuffer != 0);
+}
+
+quint64 Renderer::edgeFragments() const { return lastEdgeFragments; }
+
+void Renderer::deleteSurface() {
+  deleteBuffer(normalVBO);
+  deleteBuffer(triangleEBO);
+  deleteBuffer(maskBuffer);
+  if (maskTexture != 0) {
+    glDeleteTextures(1, &maskTexture);
+    maskTexture = 0;
+  }
+  trianglesCount = 0;
+  surfaceUploading = false;
+}
+
+void Renderer::uploadBufferSlice(GLuint buffer, const void *data,
+                                 std::size_t total, std::size_t &offset) {
+  std::size_t size = std::min<std::size_t>(UPLOAD_SLICE_BYTES, total - offset);
+  if (size > 0) {
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset),
+                    static_cast<GLsizeiptr>(size),
+                    static_cast<const char *>(data) + offset);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+  offset += size;
+}
+
+void Renderer::swapUploadedBuffers() {
+  deleteBuffer(VBO);
+  deleteBuffer(EBO);
+  deleteSurface();
+  VBO = uploadVBO;
+  uploadVBO = 0;
+  verticesCount = uploadVertices;
+  edgeIndices = 0;
+
+  if (coreProfile) {
+    if (!vao.isCreated()) vao.create();
+    vao.bind();
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(ATTRIBUTE_POSITION, 3, GL_FLOAT, GL_FALSE,
+                          sizeof(Vertex_t), nullptr);
+    glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+    vao.release();
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+  }
+}
+
+void Renderer::render(const ViewState &state) {
+  glViewport(0, 0, state.size.width(), state.size.height());
+  QVector4D background = state.settings.backgroundColor();
+  glClearColor(background.x(), background.y(), background.z(), 1.0f);
+  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+  if (VBO == 0) return;
+
+  stateCache.invalidate();
+  updateTransformation(state);
+
+  int mode = state.settings.displayMode;
+  bool surface = mode != DisplayMode_e::Wireframe_e && trianglesCount > 0;
+  bool edges = !surface || mode == DisplayMode_e::SurfaceEdges_e;
+  bool triangleWire = edges && maskTexture != 0 && usesTriangleWire(state);
+  bool lines = edges && !triangleWire && edgeIndices > 0;
+  bool points = !surface && (state.settings.verticesStyle || pointCloud);
+  bool hiddenLine =
+      !surface && trianglesCount > 0 &&
+      state.settings.edgesStyle == EdgesStyle_e::HiddenLineEdges_e;
+
+  if (surface) drawSurface(state);
+  if (hiddenLine) drawDepthPrepass();
+  if (triangleWire) drawTriangleWire(state);
+  if (lines || points) {
+    bindGeometry();
+
+    if (lines) {
+      beginFragmentQuery();
+      drawEdges(state);
+      endFragmentQuery();
+    }
+    if (points) drawVertices(state);
+
+    releaseGeometry();
+  }
+  stateCache.useProgram(0);
+}
+
+void Renderer::drawDepthPrepass() {
+  stateCache.useProgram(surfaceProgram->programId());
+  surfaceProgram->setUniformValue(surfaceLocations.mvpMatrix,
+                                  transformationMatrix);
+  glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+  stateCache.setEnabled(GL_POLYGON_OFFSET_FILL, true);
+  glPolygonOffset(1.0f, 1.0f);
+
+  bindSurface();
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(trianglesCount * 3),
+                 GL_UNSIGNED_INT, nullptr);
+  releaseSurface();
+
+  stateCache.setEnabled(GL_POLYGON_OFFSET_FILL, false);
+  glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+void Renderer::beginFragmentQuery() {
+  GLuint query = fragmentQueries[queryIndex];
+  if (queryPending[queryIndex]) {
+    GLuint available = 0;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available) {
+      GLuint samples = 0;
+      glGetQueryObjectuiv(query, GL_QUERY_RESULT, &samples);
+      lastEdgeFragments = samples;
+    }
+    queryPending[queryIndex] = false;
+  }
+  glBeginQuery(GL_SAMPLES_PASSED, query);
+}
+
+void Renderer::endFragmentQuery() {
+  glEndQuery(GL_SAMPLES_PASSED);
+  queryPending[queryIndex] = true;
+  queryIndex ^= 1;
+}
+
+void Renderer::drawTriangleWire(const ViewState &state) {
+  stateCache.useProgram(wireProgram->programId());
+  wireProgram->setUniformValue(wireLocations.mvpMatrix, transformationMatrix);
+  wireProgram->setUniformValue(wireLocations.color, edgesColor(state));
+  wireProgram->setUniformValue(wireLocations.lineWidth,
+                               std::max(1.0f, state.settings.lineWidth() *
+                                                  state.resolutionScale));
+  wireProgram->setUniformValue(wireLocations.edgeMasks, 0);
+  glActiveTexture(GL_TEXTURE0);
+  glBindTexture(GL_TEXTURE_BUFFER, maskTexture);
+
+  bindSurface();
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(trianglesCount * 3),
+                 GL_UNSIGNED_INT, nullptr);
+  releaseSurface();
+
+  glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+QVector4D Renderer::edgesColor(const ViewState &state) const {
+  QVector4D color = state.settings.edgesColor();
+  if (state.settings.displayMode == DisplayMode_e::SurfaceEdges_e) {
+    color = QVector4D(color.toVector3D() * 0.5f, 1.0f);
+  }
+  return color;
+}
+
+void Renderer::drawSurface(const ViewState &state) {
+  stateCache.useProgram(surfaceProgram->programId());
+  surfaceProgram->setUniformValue(surfaceLocations.mvpMatrix,
+                                  transformationMatrix);
+  surfaceProgram->setUniformValue(surfaceLocations.modelMatrix,
+                                  state.transformation);
+  surfaceProgram->setUniformValue(surfaceLocations.color,
+                                  state.settings.edgesColor());
+  stateCache.setEnabled(GL_POLYGON_OFFSET_FILL, true);
+  glPolygonOffset(1.0f, 1.0f);
+
+  bindSurface();
+  glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(trianglesCount * 3),
+                 GL_UNSIGNED_INT, nullptr);
+  releaseSurface();
+
+  stateCache.setEnabled(GL_POLYGON_OFFSET_FILL, false);
+}
+
+void Renderer::bindSurface() {
+  if (coreProfile) {
+    stateCache.bindVertexArray(surfaceVao.objectId());
+  } else {
+    stateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, triangleEBO);
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, VBO);
+    glVertexAttribPointer(ATTRIBUTE_POSITION, 3, GL_FLOAT, GL_FALSE,
+                          sizeof(Vertex_t), nullptr);
+    glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, normalVBO);
+    glVertexAttribPointer(ATTRIBUTE_NORMAL, 3, GL_FLOAT, GL_FALSE,
+                          sizeof(Vertex_t), nullptr);
+    glEnableVertexAttribArray(ATTRIBUTE_NORMAL);
+  }
+}
+
+void Renderer::releaseSurface() {
+  if (coreProfile) {
+    stateCache.bindVertexArray(0);
+  } else {
+    glDisableVertexAttribArray(ATTRIBUTE_POSITION);
+    glDisableVertexAttribArray(ATTRIBUTE_NORMAL);
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, 0);
+    stateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  }
+}
+
+void Renderer::bindGeometry() {
+  if (coreProfile) {
+    stateCache.bindVertexArray(vao.objectId());
+  } else {
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, VBO);
+    stateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+    glVertexAttribPointer(ATTRIBUTE_POSITION, 3, GL_FLOAT, GL_FALSE,
+                          sizeof(Vertex_t), nullptr);
+    glEnableVertexAttribArray(ATTRIBUTE_POSITION);
+  }
+}
+
+void Renderer::releaseGeometry() {
+  if (coreProfile) {
+    stateCache.bindVertexArray(0);
+  } else {
+    glDisableVertexAttribArray(ATTRIBUTE_POSITION);
+    stateCache.bindBuffer(GL_ARRAY_BUFFER, 0);
+    stateCache.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+  }
+}
+
+void Renderer::updateTransformation(const ViewState &state) {
+  transformationMatrix.setToIdentity();
+  setProjection(state);
+  transformationMatrix.translate(0.0f, 0.0f, -2.0f);
+  transformationMatrix *= state.transformation;
+  updateFrustum();
+}
+
+void Renderer::updateFrustum() {
+  QVector4D w = transformationMatrix.row(3);
+  for (int axis = 0; axis < 3; ++axis) {
+    QVector4D row = transformationMatrix.row(axis);
+    frustum[axis * 2] = w + row;
+    frustum[axis * 2 + 1] = w - row;
+  }
+}
+
+bool Renderer::isVisible(const Cluster_t &cluster) const {
+  bool visible = true;
+  for (int i = 0; i < 6 && visible; ++i) {
+    const QVector4D &plane = frustum[i];
+    float x = plane.x() >= 0 ? cluster.max.x : cluster.min.x;
+    float y = plane.y() >= 0 ? cluster.max.y : cluster.min.y;
+    float z = plane.z() >= 0 ? cluster.max.z : cluster.min.z;
+    visible = plane.x() * x + plane.y() * y + plane.z() * z + plane.w() >= 0;
+  }
+  return visible;
+}
+
+void Renderer::cullEdges(float detail) {
+  drawRuns.clear();
+  std::size_t end = 0;
+  for (const Cluster_t &cluster : clusters) {
+    if (!isVisible(cluster)) continue;
+    std::size_t first =
+        primitiveRestart ? cluster.indexOffset : cluster.firstStrip;
+    std::size_t total = primitiveRestart ? cluster.indexCount : cluster.strips;
+    std::size_t count = total;
+    if (detail < 1.0f) {
+      count = std::max<std::size_t>(
+          1, static_cast<std::size_t>(std::ceil(total * detail)));
+    }
+    if (!drawRuns.empty() && end == first) {
+      drawRuns.back().second += count;
+    } else {
+      drawRuns.push_back({first, count});
+    }
+    end = count == total ? first + count : 0;
+  }
+}
+
+void Renderer::setProjection(const ViewState &state) {
+  QSize image = state.imageSize.isEmpty() ? state.size : state.imageSize;
+  float aspect = static_cast<float>(image.width()) / image.height();
+  if (!state.imageSize.isEmpty() && state.tile.isValid()) {
+    QRectF tile = state.tile;
+    float x0 = 2.0f * tile.left() / image.width() - 1.0f;
+    float x1 = 2.0f * (tile.left() + tile.width()) / image.width() - 1.0f;
+    float y0 = 2.0f * tile.top() / image.height() - 1.0f;
+    float y1 = 2.0f * (tile.top() + tile.height()) / image.height() - 1.0f;
+    transformationMatrix.scale(2.0f / (x1 - x0), 2.0f / (y1 - y0), 1.0f);
+    transformationMatrix.translate(-(x0 + x1) / 2.0f, -(y0 + y1) / 2.0f,
+                                   0.0f);
+  }
+  float nearPlane = 0.1f;
+  float farPlane = 100.0f;
+  float fov = 45.0f;
+
+  float top = tan((fov * M_PI / 360.0)) * nearPlane;
+  float bottom = -top;
+  float right = top * aspect;
+  float left = -right;
+
+  if (state.settings.isOrtho) {
+    transformationMatrix.ortho(-aspect, aspect, -1.0, 1.0, -1.0, 100.0);
+  } else {
+    transformationMatrix.frustum(left, right, bottom, top, nearPlane, farPlane);
+  }
+}
+
+void Renderer::useVariant(ProgramVariant_e variant, const QVector4D &color) {
+  static const char *const kDefines[ProgramVariants_e] = {
+      "", "#define DASHED\n", "#define ROUND_POINTS\n", ""};
+  if (!variants[variant]) {
+    bool wideLines =
+        coreProfile && (variant == ProgramVariant_e::SolidLines_e ||
+                        variant == ProgramVariant_e::DashedLines_e);
+    QByteArray defines = kDefines[variant];
+    if (wideLines) defines += "#define WIDE_LINES\n";
+    QOpenGLShaderProgram *program = createProgram(
+        ":/shaders/vertex_shader.glsl", ":/shaders/fragment_shader.glsl",
+        wideLines ? ":/shaders/line_geometry_shader.glsl" : QString(),
+        defines);
+    variantLocations[variant].mvpMatrix =
+        program->uniformLocation("mvp_matrix");
+    variantLocations[variant].color = program->uniformLocation("color");
+    variantLocations[variant].lineWidth =
+        program->uniformLocation("lineWidth");
+    variantLocations[variant].viewportSize =
+        program->uniformLocation("viewportSize");
+    variants[variant] = program;
+  }
+  QOpenGLShaderProgram *program = variants[variant];
+  stateCache.useProgram(program->programId());
+  program->setUniformValue(variantLocations[variant].mvpMatrix,
+                           transformationMatrix);
+  program->setUniformValue(variantLocations[variant].color, color);
+}
+
+void Renderer::drawVertices(const ViewState &state) {
+  bool isRound = state.settings.verticesStyle == 1;
+  if (!coreProfile) stateCache.setEnabled(GL_POINT_SMOOTH, isRound);
+  useVariant(isRound && coreProfile ? ProgramVariant_e::RoundPoints_e
+                                    : ProgramVariant_e::SquarePoints_e,
+             state.settings.verticesColor());
+  stateCache.pointSize(state.settings.pointSize() * state.resolutionScale);
+
+  if (state.detail < 1.0f && !clusters.empty()) {
+    cullEdges(state.detail);
+    drawRanges(GL_POINTS);
+  } else if (state.detail < 1.0f && pointCloud) {
+    GLsizei count = static_cast<GLsizei>(verticesCount * state.detail);
+    glDrawArrays(GL_POINTS, 0, std::max<GLsizei>(1, count));
+  } else {
+    glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(verticesCount));
+  }
+}
+
+void Renderer::drawEdges(const ViewState &state) {
+  ProgramVariant_e variant =
+      state.settings.edgesStyle == EdgesStyle_e::DashedEdges_e
+          ? ProgramVariant_e::DashedLines_e
+          : ProgramVariant_e::SolidLines_e;
+  useVariant(variant, edgesColor(state));
+  float width = state.settings.lineWidth() * state.resolutionScale;
+  if (coreProfile) {
+    variants[variant]->setUniformValue(variantLocations[variant].lineWidth,
+                                       std::max(1.0f, width));
+    variants[variant]->setUniformValue(
+        variantLocations[variant].viewportSize,
+        QVector2D(state.size.width(), state.size.height()));
+  } else {
+    stateCache.lineWidth(width);
+  }
+  if (clusters.empty()) {
+    if (primitiveRestart) {
+      glDrawElements(GL_LINE_STRIP, static_cast<GLsizei>(edgeIndices),
+                     GL_UNSIGNED_INT, nullptr);
+    } else {
+      drawStrips(GL_LINE_STRIP, 0, uploadedStrips());
+    }
+    return;
+  }
+  cullEdges(state.detail);
+  drawRanges(GL_LINE_STRIP);
+}
+
+void Renderer::drawRanges(GLenum mode) {
+  if (primitiveRestart) {
+    drawCounts.clear();
+    drawOffsets.clear();
+    for (const auto &[first, count] : drawRuns) {
+      drawCounts.push_back(static_cast<GLsizei>(count));
+      drawOffsets.push_back(
+          reinterpret_cast<const void *>(first * sizeof(unsigned int)));
+    }
+    if (multiDrawElements) {
+      multiDrawElements(mode, drawCounts.data(), GL_UNSIGNED_INT,
+                        drawOffsets.data(),
+                        static_cast<GLsizei>(drawCounts.size()));
+    } else {
+      for (std::size_t i = 0; i < drawCounts.size(); ++i) {
+        glDrawElements(mode, drawCounts[i], GL_UNSIGNED_INT, drawOffsets[i]);
+      }
+    }
+  } else {
+    for (const auto &[first, count] : drawRuns) {
+      drawStrips(mode, first, count);
+    }
+  }
+}
+
+void Renderer::drawStrips(GLenum mode, std::size_t first, std::size_t count) {
+  if (count == 0) return;
+  if (multiDrawElements) {
+    multiDrawElements(mode, stripCounts.data() + first, GL_UNSIGNED_INT,
+                      stripOffsets.data() + first,
+                      static_cast<GLsizei>(count));
+  } else {
+    for (std::size_t i = first; i < first + count; ++i) {
+      glDrawElements(mode, stripCounts[i], GL_UNSIGNED_INT, stripOffsets[i]);
+    }
+  }
+}
+
+}  // namespace s21
\ No newline at end of file
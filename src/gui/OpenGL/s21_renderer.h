@@ -0,0 +1,456 @@
+/// @mainpage
+/// @file s21_renderer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_RENDERER_H
+#define S21_RENDERER_H
+
+#include "../s21_gui_defines.h"
+#include "../s21_render_settings.h"
+#include "s21_gl_state_cache.h"
+
+/// @brief Положение атрибута позиции вершины во всех программах
+#define ATTRIBUTE_POSITION 0
+/// @brief Положение атрибута нормали вершины во всех программах
+#define ATTRIBUTE_NORMAL 1
+
+namespace s21 {
+
+/// @brief Указатель на glMultiDrawElements, которой нет в OpenGL ES
+typedef void(QOPENGLF_APIENTRYP MultiDrawElements_t)(GLenum, const GLsizei *,
+                                                     GLenum,
+                                                     const void *const *,
+                                                     GLsizei);
+/// @brief Указатель на glPrimitiveRestartIndex, OpenGL 3.1+
+typedef void(QOPENGLF_APIENTRYP PrimitiveRestartIndex_t)(GLuint);
+
+#ifndef GL_PRIMITIVE_RESTART
+#define GL_PRIMITIVE_RESTART 0x8F9D
+#endif
+#ifndef GL_PRIMITIVE_RESTART_FIXED_INDEX
+#define GL_PRIMITIVE_RESTART_FIXED_INDEX 0x8D69
+#endif
+
+/// @brief Снимок состояния сцены, по которому рисуется один кадр
+struct ViewState {
+  /// @brief Матрица трансформаций модели
+  QMatrix4x4 transformation;
+  /// @brief Размер области отрисовки в пикселях устройства
+  QSize size = QSize(1, 1);
+  /// @brief Настройки отрисовки
+  RenderSettingsData settings;
+  /// @brief Время самого раннего учтенного в кадре ввода, нс, 0 - без ввода
+  qint64 inputTime = 0;
+  /// @brief Доля рисуемых ребер и вершин, меньше 1 при взаимодействии
+  float detail = 1.0f;
+  /// @brief Масштаб size относительно окна, толщины линий и размер точек
+  /// умножаются на него
+  float resolutionScale = 1.0f;
+  /// @brief Размер всего изображения при отрисовке по плиткам, пустой -
+  /// изображение совпадает с size
+  QSize imageSize;
+  /// @brief Плитка в пикселях изображения от левого нижнего угла, size
+  /// равен ее размеру
+  QRect tile;
+};
+
+/// @brief Статистика выведенного кадра
+struct FrameStatistics {
+  /// @brief Время процессора на отрисовку кадра, мс
+  double cpuTime = 0.0;
+  /// @brief Фрагментов ребер, прошедших тест глубины, в одном из прошлых
+  /// кадров
+  quint64 edgeFragments = 0;
+  /// @brief Задержка от ввода до вывода кадра на экран, мс, 0 - без ввода
+  double latency = 0.0;
+  /// @brief Кадров в секунду при перетаскивании мышью
+  double fps = 0.0;
+  /// @brief Доля ребер и вершин, рисуемых при взаимодействии
+  double detail = 1.0;
+  /// @brief Масштаб разрешения кадра
+  double resolutionScale = 1.0;
+  /// @brief Резидентная память до освобождения геометрии, байт
+  quint64 residentBefore = 0;
+  /// @brief Резидентная память после освобождения геометрии, байт
+  quint64 residentAfter = 0;
+};
+
+/// @brief Варианты программы линий и точек, собираемые из одних шейдеров
+/// с разными директивами препроцессора
+enum ProgramVariant_e {
+  SolidLines_e,
+  DashedLines_e,
+  RoundPoints_e,
+  SquarePoints_e,
+  ProgramVariants_e
+};
+
+/// @brief Положения атрибутов и uniform-переменных шейдера
+struct ShaderLocations {
+  /// @brief Матрица MVP
+  GLint mvpMatrix = -1;
+  /// @brief Цвет
+  GLint color = -1;
+  /// @brief Толщина линий в пикселях, только для линий 3.3 core
+  GLint lineWidth = -1;
+  /// @brief Размер области вывода в пикселях, только для линий 3.3 core
+  GLint viewportSize = -1;
+};
+
+/// @brief Положения атрибутов и uniform-переменных шейдера поверхности
+struct SurfaceLocations {
+  /// @brief Матрица MVP
+  GLint mvpMatrix = -1;
+  /// @brief Матрица модели для поворота нормалей
+  GLint modelMatrix = -1;
+  /// @brief Цвет
+  GLint color = -1;
+};
+
+/// @brief Положения uniform-переменных шейдера каркаса по треугольникам
+struct WireLocations {
+  /// @brief Матрица MVP
+  GLint mvpMatrix = -1;
+  /// @brief Цвет ребер
+  GLint color = -1;
+  /// @brief Толщина линий в пикселях
+  GLint lineWidth = -1;
+  /// @brief Текстурный буфер масок ребер
+  GLint edgeMasks = -1;
+};
+
+/// @brief Класс отрисовки сцены, не привязанный к виджету и потоку.
+/// В контексте openGL 3.3 core используется VAO, созданный при загрузке
+/// модели, в контексте 2.1 атрибуты настраиваются каждый кадр.
+class Renderer : protected QOpenGLExtraFunctions {
+ public:
+  /// @brief Стандартный конструктор
+  Renderer() = default;
+  /// @brief Деструктор, ресурсы openGL освобождаются в cleanup()
+  ~Renderer() = default;
+
+  /// @brief Формат поверхности: OpenGL 3.3 Core, если он поддерживается и
+  /// не задана переменная окружения S21_LEGACY_GL, иначе OpenGL 2.1.
+  /// Вызывается после создания QGuiApplication
+  /// @return Формат для QSurfaceFormat::setDefaultFormat
+  static QSurfaceFormat preferredFormat();
+  /// @brief Перевод матрицы трансформаций контроллера в матрицу Qt
+  /// @param m Матрица 4x4
+  /// @return Матрица Qt
+  static QMatrix4x4 toQMatrix(const Matrix &m);
+  /// @brief Инициализация функций openGL и шейдеров в текущем контексте
+  void initialize();
+  /// @brief Освобождение ресурсов openGL, контекст должен быть текущим
+  void cleanup();
+  /// @brief Удаление буферов модели из видеопамяти, рисуется пустая сцена
+  void clearGeometry();
+  /// @brief Загрузка геометрии модели в видеопамять целиком
+  /// @param vertices Вектор вершин
+  /// @param indices Индексы ломаных ребер
+  void uploadModel(const std::vector<Vertex_t> &vertices,
+                   const std::vector<unsigned int> &indices);
+  /// @brief Начало порционной загрузки: буферы выделяются без данных.
+  /// Пока вершины не загружены полностью, рисуется предыдущая модель.
+  /// Модель без вершин не загружается, а удаляет буферы из видеопамяти.
+  /// @param vertices Кол-во вершин новой модели
+  /// @param indices Кол-во индексов ломаных ребер новой модели, 0 - ребра
+  /// загружаются позже, если их потребует стиль ребер
+  void beginUpload(std::size_t vertices, std::size_t indices);
+  /// @brief Загрузка очередной порции не больше UPLOAD_SLICE_BYTES
+  /// @param vertices Вектор вершин, размер должен совпадать с beginUpload
+  /// @param indices Индексы ломаных, размер должен совпадать с beginUpload
+  /// @return true, если загрузка еще не завершена. При расхождении
+  /// размеров, например после неудачной загрузки модели, загрузка
+  /// прерывается и возвращается false
+  bool uploadSlice(const std::vector<Vertex_t> &vertices,
+                   const std::vector<unsigned int> &indices);
+  /// @brief Идет ли порционная загрузка модели, ребер или поверхности
+  /// @return true, если загрузка не завершена
+  bool isUploading() const;
+  /// @brief Подготовка буферов к кадру: очередная порция загрузки модели,
+  /// ребер или поверхности. Загрузка поверхности и ребер начинается, если
+  /// они нужны режиму отображения, и идет по одной порции за кадр.
+  /// Буфер ребер освобождается, когда каркас рисуется по треугольникам.
+  /// Освобожденная геометрия модели не перечитывается: недостающие буферы
+  /// загружаются после Controller::restoreGeometry.
+  /// @param state Состояние сцены
+  /// @param controller Контроллер с геометрией модели
+  /// @return true, если загрузка не завершена и нужен еще кадр
+  bool prepare(const ViewState &state, const Controller &controller);
+  /// @brief Загружены ли в видеопамять все буферы, нужные последнему
+  /// состоянию, и можно ли освободить геометрию в оперативной памяти
+  /// @return true, если модель загружена и загрузка завершена
+  bool isResident() const;
+  /// @brief Нужны ли состоянию буферы, которых еще нет в видеопамяти
+  /// @param state Состояние сцены
+  /// @return true, если для кадра не хватает поверхности или ребер
+  bool needsGeometry(const ViewState &state) const;
+  /// @brief Загружена ли поверхность текущей модели
+  /// @return true, если поверхность загружена или загружается
+  bool hasSurface() const;
+  /// @brief Кол-во фрагментов ребер по запросу GL_SAMPLES_PASSED.
+  /// Результат читается без ожидания, поэтому отстает на кадр-два.
+  /// @return Кол-во фрагментов
+  quint64 edgeFragments() const;
+  /// @brief Отрисовка кадра в текущий framebuffer
+  /// @param state Состояние сцены
+  void render(const ViewState &state);
+  /// @brief Используется ли путь openGL 3.3 core
+  /// @return true для контекста 3.3 core
+  bool isCoreProfile() const;
+
+ private:
+  /// @brief Загрузка исходного кода шейдера с заголовком версии GLSL
+  /// @param path Путь к шейдеру в ресурсах
+  /// @param type Тип шейдера
+  /// @param defines Директивы препроцессора варианта
+  /// @return Исходный код шейдера
+  QByteArray shaderSource(const QString &path, QOpenGLShader::ShaderType type,
+                          const QByteArray &defines) const;
+  /// @brief Выделение буферов поверхности текущей модели. Данные
+  /// загружаются по одной порции за кадр в uploadSurfaceSlice, маски ребер
+  /// - только для 3.3 core и если помещаются в текстурный буфер
+  /// @param controller Контроллер с геометрией модели
+  void beginSurface(const Controller &controller);
+  /// @brief Загрузка очередной порции нормалей, треугольников или масок.
+  /// Если геометрия освобождена или разошлась с началом загрузки,
+  /// поверхность удаляется
+  /// @param controller Контроллер с геометрией модели
+  void uploadSurfaceSlice(const Controller &controller);
+  /// @brief Привязка загруженной поверхности к VAO и текстуре масок
+  void finishSurface();
+  /// @brief Выделение буфера ребер и привязка его к VAO
+  /// @param count Кол-во индексов
+  void allocateEdges(std::size_t count);
+  /// @brief Начало порционной загрузки буфера ребер для уже загруженных
+  /// вершин, порции загружаются uploadSlice
+  /// @param count Кол-во индексов ломаных ребер
+  void beginEdges(std::size_t count);
+  /// @brief Включение primitive restart с индексом STRIP_RESTART
+  void initializePrimitiveRestart();
+  /// @brief Копирование кластеров после загрузки ребер
+  /// @param controller Контроллер модели
+  void updateClusters(const Controller &controller);
+  /// @brief Подготовка счетчиков и смещений ломаных без primitive restart.
+  /// Вызывается при выделении буфера ребер, чтобы уже загруженное начало
+  /// буфера рисовалось и во время загрузки
+  /// @param controller Контроллер модели
+  void updateStrips(const Controller &controller);
+  /// @brief Кол-во ломаных, целиком загруженных в буфер ребер
+  /// @return Кол-во первых ломаных из stripCounts
+  std::size_t uploadedStrips() const;
+  /// @brief Нужна ли загрузка поверхности для отрисовки состояния
+  /// @param state Состояние сцены
+  /// @return true, если режим требует поверхность, а она не загружена
+  bool needsSurface(const ViewState &state) const;
+  /// @brief Рисуется ли каркас по треугольникам вместо буфера ребер
+  /// @param state Состояние сцены
+  /// @return true для стилей ребер по треугольникам в контексте 3.3 core
+  bool usesTriangleWire(const ViewState &state) const;
+  /// @brief Загрузка порции данных в буфер
+  /// @param buffer Буфер назначения
+  /// @param data Начало исходных данных
+  /// @param total Полный размер данных, байт
+  /// @param offset Уже загружено байт, увеличивается на размер порции
+  void uploadBufferSlice(GLuint buffer, const void *data, std::size_t total,
+                         std::size_t &offset);
+  /// @brief Замена отрисовываемых буферов загружаемыми
+  void swapUploadedBuffers();
+  /// @brief Прерывание порционной загрузки: удаляется загружаемый буфер
+  /// вершин, а если вершины уже подменены - недогруженный буфер ребер
+  void abortUpload();
+  /// @brief Удаление буфера openGL
+  /// @param buffer Идентификатор буфера, обнуляется
+  void deleteBuffer(GLuint &buffer);
+  /// @brief Привязка геометрии для отрисовки
+  void bindGeometry();
+  /// @brief Отвязка геометрии после отрисовки
+  void releaseGeometry();
+  /// @brief Создание и связывание шейдерной программы.
+  /// Связанные программы кэшируются Qt на диске, повторный запуск
+  /// загружает готовый бинарный код без компиляции.
+  /// @param vertexPath Путь к вершинному шейдеру
+  /// @param fragmentPath Путь к фрагментному шейдеру
+  /// @param geometryPath Путь к геометрическому шейдеру, если он нужен
+  /// @param defines Директивы препроцессора варианта
+  /// @return Указатель на программу
+  QOpenGLShaderProgram *createProgram(
+      const QString &vertexPath, const QString &fragmentPath,
+      const QString &geometryPath = QString(),
+      const QByteArray &defines = QByteArray()) const;
+  /// @brief Выбор варианта программы линий и точек, вариант собирается при
+  /// первом использовании. Линии в 3.3 core расширяются геометрическим
+  /// шейдером, так как glLineWidth больше 1 там недоступен
+  /// @param variant Вариант программы
+  /// @param color Цвет примитивов
+  void useVariant(ProgramVariant_e variant, const QVector4D &color);
+  /// @brief Инициализирует шейдерную программу для использования в OpenGL.
+  void initializeShader();
+  /// @brief Удаление буферов поверхности
+  void deleteSurface();
+  /// @brief Привязка геометрии поверхности
+  void bindSurface();
+  /// @brief Отвязка геометрии поверхности
+  void releaseSurface();
+  /// @brief Отрисовка поверхности с освещением
+  /// @param state Состояние сцены
+  void drawSurface(const ViewState &state);
+  /// @brief Отрисовка каркаса по треугольникам поверхности
+  /// @param state Состояние сцены
+  void drawTriangleWire(const ViewState &state);
+  /// @brief Заполнение буфера глубины треугольниками без записи цвета.
+  /// Грани смещаются назад, чтобы ребра на них проходили тест глубины.
+  void drawDepthPrepass();
+  /// @brief Начало подсчета фрагментов ребер, забирает готовый результат
+  void beginFragmentQuery();
+  /// @brief Конец подсчета фрагментов ребер
+  void endFragmentQuery();
+  /// @brief Цвет ребер с учетом режима отображения
+  /// @param state Состояние сцены
+  /// @return Цвет в диапазоне [0, 1]
+  QVector4D edgesColor(const ViewState &state) const;
+  /// @brief Обновляет матрицу трансформации объекта.
+  /// @param state Состояние сцены
+  void updateTransformation(const ViewState &state);
+  /// @brief Устанавливает проекцию для отображения сцены. Для плитки
+  /// проекция всего изображения растягивается так, что плитка занимает
+  /// весь viewport
+  /// @param state Состояние сцены
+  void setProjection(const ViewState &state);
+  /// @brief Отрисовывает вершины на экране с использованием текущих настроек.
+  /// @param state Состояние сцены
+  void drawVertices(const ViewState &state);
+  /// @brief Отрисовывает рёбра на экране с использованием текущих настроек.
+  /// @param state Состояние сцены
+  void drawEdges(const ViewState &state);
+  /// @brief Расчет плоскостей пирамиды видимости из transformationMatrix
+  void updateFrustum();
+  /// @brief Пересекает ли кластер пирамиду видимости
+  /// @param cluster Кластер ребер
+  /// @return false, если кластер целиком за одной из плоскостей
+  bool isVisible(const Cluster_t &cluster) const;
+  /// @brief Сбор диапазонов видимых кластеров в drawRuns: индексов или,
+  /// без primitive restart, ломаных.
+  /// От кластера берется начало длиной detail, соседние в буфере целые
+  /// кластеры объединяются в один диапазон.
+  /// @param detail Доля индексов или ломаных кластера
+  void cullEdges(float detail);
+  /// @brief Отрисовка собранных cullEdges диапазонов буфера ребер
+  /// @param mode Тип примитивов
+  void drawRanges(GLenum mode);
+  /// @brief Отрисовка ломаных без primitive restart через
+  /// glMultiDrawElements, а без него - по одной glDrawElements
+  /// @param mode Тип примитивов
+  /// @param first Первая ломаная
+  /// @param count Кол-во ломаных
+  void drawStrips(GLenum mode, std::size_t first, std::size_t count);
+
+  /// @brief Варианты программы линий и точек
+  QOpenGLShaderProgram *variants[ProgramVariants_e] = {};
+  /// @brief Положения переменных вариантов программы
+  ShaderLocations variantLocations[ProgramVariants_e];
+  /// @brief Программа шейдера поверхности
+  QOpenGLShaderProgram *surfaceProgram = nullptr;
+  /// @brief Положения переменных шейдера поверхности
+  SurfaceLocations surfaceLocations;
+  /// @brief Объект вершинного массива поверхности для пути 3.3 core
+  QOpenGLVertexArrayObject surfaceVao;
+  /// @brief Буфер нормалей вершин
+  GLuint normalVBO = 0;
+  /// @brief Буфер индексов треугольников
+  GLuint triangleEBO = 0;
+  /// @brief Программа шейдера каркаса по треугольникам
+  QOpenGLShaderProgram *wireProgram = nullptr;
+  /// @brief Положения переменных шейдера каркаса
+  WireLocations wireLocations;
+  /// @brief Буфер масок ребер треугольников
+  GLuint maskBuffer = 0;
+  /// @brief Текстура над буфером масок ребер
+  GLuint maskTexture = 0;
+  /// @brief Нужен ли буфер ребер в текущем режиме
+  bool edgesWanted = true;
+  /// @brief Запросы подсчета фрагментов, используются по очереди
+  GLuint fragmentQueries[2] = {0, 0};
+  /// @brief Запрос ожидает чтения результата
+  bool queryPending[2] = {false, false};
+  /// @brief Текущий запрос
+  int queryIndex = 0;
+  /// @brief Последний прочитанный результат подсчета фрагментов
+  quint64 lastEdgeFragments = 0;
+  /// @brief Кол-во треугольников в буфере
+  std::size_t trianglesCount = 0;
+  /// @brief Кэш состояния openGL
+  GLStateCache stateCache;
+  /// @brief Объект вершинного массива для пути 3.3 core
+  QOpenGLVertexArrayObject vao;
+  /// @brief Контекст openGL 3.3 core
+  bool coreProfile = false;
+  /// @brief Идентификатор буфера вершин для OpenGL.
+  GLuint VBO = 0;
+  /// @brief Идентификатор буфера элементов для OpenGL.
+  GLuint EBO = 0;
+  /// @brief Кол-во вершин в буфере
+  std::size_t verticesCount = 0;
+  /// @brief Кол-во индексов ломаных в буфере ребер
+  std::size_t edgeIndices = 0;
+  /// @brief В буфере облако точек без ребер: вершины рисуются всегда, а при
+  /// взаимодействии рисуется начало буфера
+  bool pointCloud = false;
+  /// @brief Доступен primitive restart, иначе ломаные рисуются по
+  /// отдельности
+  bool primitiveRestart = false;
+  /// @brief Кол-во индексов каждой ломаной, без primitive restart
+  std::vector<GLsizei> stripCounts;
+  /// @brief Смещения ломаных в буфере ребер, без primitive restart
+  std::vector<const void *> stripOffsets;
+  /// @brief Видимые диапазоны: первый индекс или ломаная и кол-во
+  std::vector<std::pair<std::size_t, std::size_t>> drawRuns;
+  /// @brief Кластеры ребер в буфере, пусто до окончания загрузки
+  std::vector<Cluster_t> clusters;
+  /// @brief Кластеры соответствуют буферу ребер, в том числе пустые
+  bool clustersCurrent = false;
+  /// @brief Плоскости пирамиды видимости в пространстве модели
+  QVector4D frustum[6];
+  /// @brief Кол-во индексов в видимых диапазонах, с primitive restart
+  std::vector<GLsizei> drawCounts;
+  /// @brief Смещения видимых диапазонов в буфере ребер
+  std::vector<const void *> drawOffsets;
+  /// @brief glMultiDrawElements, если доступна в контексте
+  MultiDrawElements_t multiDrawElements = nullptr;
+  /// @brief Загружаемый буфер вершин
+  GLuint uploadVBO = 0;
+  /// @brief Кол-во вершин загружаемой модели
+  std::size_t uploadVertices = 0;
+  /// @brief Кол-во индексов ломаных загружаемой модели
+  std::size_t uploadIndices = 0;
+  /// @brief Загружено байт вершин
+  std::size_t uploadedVertexBytes = 0;
+  /// @brief Загружено байт ребер
+  std::size_t uploadedEdgeBytes = 0;
+  /// @brief Идет порционная загрузка вершин или ребер
+  bool uploading = false;
+  /// @brief Идет порционная загрузка поверхности
+  bool surfaceUploading = false;
+  /// @brief Кол-во треугольников загружаемой поверхности
+  std::size_t uploadTriangles = 0;
+  /// @brief Размер загружаемых масок ребер, 0 - маски не загружаются
+  std::size_t uploadMasks = 0;
+  /// @brief Загружено байт нормалей
+  std::size_t uploadedNormalBytes = 0;
+  /// @brief Загружено байт треугольников
+  std::size_t uploadedTriangleBytes = 0;
+  /// @brief Загружено байт масок ребер
+  std::size_t uploadedMaskBytes = 0;
+  /// @brief Матрица трансформации для управления положением и ориентацией
+  /// объекта.
+  QMatrix4x4 transformationMatrix;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
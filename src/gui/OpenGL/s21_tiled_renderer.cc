@@ -0,0 +1,52 @@
+#include "s21_tiled_renderer.h"
+
+namespace s21 {
+
+TiledRenderer::TiledRenderer(Renderer &target) : renderer(target) {}
+
+bool TiledRenderer::render(const ViewState &view, const QSize &imageSize,
+                           const QString &path) {
+  PngWriter png;
+  if (imageSize.isEmpty() ||
+      !png.open(path.toStdString(), imageSize.width(), imageSize.height())) {
+    return false;
+  }
+  QSize tileSize = imageSize.boundedTo(QSize(TILE_SIZE, TILE_SIZE));
+  QOpenGLFramebufferObject buffer(
+      tileSize, QOpenGLFramebufferObject::CombinedDepthStencil);
+  FrameReader reader;
+  reader.initialize();
+
+  ViewState state = view;
+  state.imageSize = imageSize;
+  state.detail = 1.0f;
+  state.resolutionScale = static_cast<float>(imageSize.width()) /
+                          std::max(1, view.size.width()) *
+                          view.resolutionScale;
+  std::size_t rowBytes = static_cast<std::size_t>(imageSize.width()) * 3;
+  std::vector<std::uint8_t> band(rowBytes * tileSize.height());
+
+  for (int top = 0; top < imageSize.height(); top += tileSize.height()) {
+    int height = std::min(tileSize.height(), imageSize.height() - top);
+    for (int left = 0; left < imageSize.width(); left += tileSize.width()) {
+      int width = std::min(tileSize.width(), imageSize.width() - left);
+      state.size = QSize(width, height);
+      state.tile = QRect(left, imageSize.height() - top - height, width,
+                         height);
+      buffer.bind();
+      renderer.render(state);
+      QImage tile = reader.read(buffer.handle(), state.size)
+                        .convertToFormat(QImage::Format_RGB888);
+      for (int y = 0; y < height; ++y) {
+        std::memcpy(band.data() + y * rowBytes + left * 3,
+                    tile.constScanLine(y), width * 3);
+      }
+    }
+    for (int y = 0; y < height; ++y) png.writeRow(band.data() + y * rowBytes);
+  }
+  buffer.release();
+  reader.cleanup();
+  return png.close();
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,48 @@
+/// @mainpage
+/// @file s21_tiled_renderer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_TILED_RENDERER_H
+#define S21_TILED_RENDERER_H
+
+#include "../image/s21_png_writer.h"
+#include "../s21_gui_defines.h"
+#include "s21_frame_reader.h"
+#include "s21_renderer.h"
+
+namespace s21 {
+
+/// @brief Отрисовка изображения больше окна по плиткам.
+/// Проекция всего изображения делится на части, каждая плитка рисуется во
+/// внеэкранный буфер размера TILE_SIZE и читается обратно. Плитки одной
+/// полосы собираются в полосу строк, которая сразу сжимается в PNG, поэтому
+/// в памяти никогда не лежит все изображение.
+class TiledRenderer {
+ public:
+  /// @brief Конструктор
+  /// @param target Объект отрисовки с загруженной моделью, его контекст
+  /// должен быть текущим
+  explicit TiledRenderer(Renderer &target);
+
+  /// @brief Отрисовка и запись изображения
+  /// @param view Состояние сцены в окне, толщины линий и размер точек
+  /// масштабируются так, чтобы изображение выглядело как окно
+  /// @param imageSize Размер изображения
+  /// @param path Путь к файлу PNG
+  /// @return false, если файл не записан
+  bool render(const ViewState &view, const QSize &imageSize,
+              const QString &path);
+
+ private:
+  /// @brief Объект отрисовки
+  Renderer &renderer;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -2,171 +2,308 @@
 
 namespace s21 {
 
-ViewerWidget::ViewerWidget(QWidget* parent, QSettings* set)
+ViewerWidget::ViewerWidget(QWidget* parent, RenderSettings* set)
     : QOpenGLWidget{parent}, settings(set) {
   controller = new Controller();
+  threaded = settings->data().threadedRendering;
+  connect(settings, &RenderSettings::changed, this,
+          &ViewerWidget::restoreGeometry);
+  connect(settings, &RenderSettings::changed, this, &ViewerWidget::refresh);
+  connect(this, &QOpenGLWidget::frameSwapped, this,
+          &ViewerWidget::onFrameSwapped);
+  idleTimer.setSingleShot(true);
+  connect(&idleTimer, &QTimer::timeout, this, &ViewerWidget::endInteraction);
+  clock.start();
   this->setMinimumSize(1000, 1000);
 }
 
 ViewerWidget::~ViewerWidget() {
+  makeCurrent();
+  if (renderThread) {
+    delete renderThread;
+    renderThread = nullptr;
+  }
+  delete scaledBuffer;
+  scaledBuffer = nullptr;
+  if (blitter.isCreated()) blitter.destroy();
+  frameReader.cleanup();
+  renderer.cleanup();
+  doneCurrent();
   delete controller;
   controller = nullptr;
-  if (shaderProgram) {
-    delete shaderProgram;
-    shaderProgram = nullptr;
-  }
-  if (VBO != 0) {
-    glDeleteBuffers(1, &VBO);
-    VBO = 0;
-  }
-  if (EBO != 0) {
-    glDeleteBuffers(1, &EBO);
-    EBO = 0;
-  }
 }
 
 void ViewerWidget::initializeGL() {
   initializeOpenGLFunctions();
+  blitter.create();
+  frameReader.initialize();
+
+  if (threaded) {
+    renderThread = new RenderThread(context(), controller);
+    connect(renderThread, &RenderThread::frameReady, this,
+            [this](double cpuTime, qint64 frameInput, quint64 fragments) {
+              statistics.cpuTime = cpuTime;
+              statistics.edgeFragments = fragments;
+              if (frameInput) frameInputTime = frameInput;
+              update();
+            });
+    connect(renderThread, &RenderThread::geometryReleased, this,
+            [this](quint64 before, quint64 after) {
+              statistics.residentBefore = before;
+              statistics.residentAfter = after;
+            });
+    connect(renderThread, &RenderThread::tiledSaved, this,
+            &ViewerWidget::tiledScreenshotSaved);
+    renderThread->start();
+    renderThread->postState(currentState());
+  } else {
+    renderer.initialize();
+  }
+}
 
-  initializeShader();
-
-  glEnable(GL_DEPTH_TEST);
+Status_e ViewerWidget::loadModel(QString pathToFile) {
+  Status_e status = Status_e::OK;
+  const RenderSettingsData &data = settings->data();
+  controller->setPointCloudResolution(std::max(0, data.pointCloudResolution));
+  LoadOptions_t options = data.loadOptions();
+  if (renderThread) {
+    QMutexLocker locker(&renderThread->geometryMutex());
+    status = controller->loadModel(pathToFile.toStdString(), options);
+  } else {
+    status = controller->loadModel(pathToFile.toStdString(), options);
+  }
+  if (status == Status_e::OK || modelInfo().displayed == 0) {
+    uploadGeometry();
+  }
+  return status;
 }
 
-void ViewerWidget::initializeShader() {
-  shaderProgram = new QOpenGLShaderProgram(this);
-  shaderProgram->addShaderFromSourceFile(QOpenGLShader::Vertex,
-                                         ":/shaders/vertex_shader.glsl");
-  shaderProgram->addShaderFromSourceFile(QOpenGLShader::Fragment,
-                                         ":/shaders/fragment_shader.glsl");
-  if (!shaderProgram->link()) {
-    qDebug() << "Ошибка связывания шейдерной программы:"
-             << shaderProgram->log();
+void ViewerWidget::uploadGeometry() {
+  if (renderThread) {
+    renderThread->requestUpload();
+  } else {
+    std::size_t strips = settings->data().loadOptions().edges
+                             ? controller->getEdgeStrips().size()
+                             : 0;
+    makeCurrent();
+    renderer.beginUpload(controller->getDisplayVertices().size(), strips);
+    doneCurrent();
+    refresh();
   }
 }
 
-Status_e ViewerWidget::loadModel(QString pathToFile) {
-  Status_e status = controller->loadModel(pathToFile.toStdString());
-  if (status == Status_e::OK) {
-    if (VBO != 0) {
-      glDeleteBuffers(1, &VBO);
-      VBO = 0;
+void ViewerWidget::restoreGeometry() {
+  ViewState state = currentState();
+  Status_e status = Status_e::OK;
+  if (renderThread) {
+    QMutexLocker locker(&renderThread->geometryMutex());
+    if (!controller->isGeometryLoaded() &&
+        renderThread->needsGeometry(state)) {
+      status = controller->restoreGeometry();
     }
-    if (EBO != 0) {
-      glDeleteBuffers(1, &EBO);
-      EBO = 0;
-    }
-
-    glGenBuffers(1, &VBO);
-    glGenBuffers(1, &EBO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
-    glBufferData(GL_ARRAY_BUFFER, (getVerticesSize()) * sizeof(Vertex_t),
-                 controller->getVertices().data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, getEdgesSize() * sizeof(Edge_t),
-                 controller->getEdges().data(), GL_STATIC_DRAW);
+  } else if (!controller->isGeometryLoaded() &&
+             renderer.needsGeometry(state)) {
+    status = controller->restoreGeometry();
+  }
+  if (status != Status_e::OK) {
+    uploadGeometry();
+    emit geometryRestoreFailed(status);
   }
-  return status;
 }
 
-void ViewerWidget::resizeGL(int w, int h) { glViewport(0, 0, w, h); }
+void ViewerWidget::resizeGL(int, int) { stateChanged = true; }
 
 void ViewerWidget::paintGL() {
-  glClearColor(settings->value("backgroundColorRed").toInt() / 255.0f,
-               settings->value("backgroundColorGreen").toInt() / 255.0f,
-               settings->value("backgroundColorBlue").toInt() / 255.0f, 1.0f);
-  glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-
-  updateTransformation();
+  flushInput();
+  if (renderThread) {
+    if (stateChanged) {
+      renderThread->postState(currentState());
+      stateChanged = false;
+      inputTime = 0;
+    }
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    renderThread->drawFrontFrame(blitter, QRect(QPoint(0, 0), pixelSize()));
+  } else {
+    QElapsedTimer frameTimer;
+    frameTimer.start();
+    ViewState state = currentState();
+    if (renderer.prepare(state, *controller)) update();
+    if (state.settings.gpuResident && renderer.isResident() &&
+        controller->isGeometryLoaded()) {
+      statistics.residentBefore = residentMemory();
+      controller->releaseGeometry();
+      statistics.residentAfter = residentMemory();
+    }
+    if (state.resolutionScale < 1.0f) {
+      renderScaled(state);
+    } else {
+      delete scaledBuffer;
+      scaledBuffer = nullptr;
+      renderer.render(state);
+    }
+    statistics.cpuTime = frameTimer.nsecsElapsed() / 1e6;
+    statistics.edgeFragments = renderer.edgeFragments();
+    frameInputTime = inputTime;
+    inputTime = 0;
+    stateChanged = false;
+  }
+  if (captureRequested) {
+    frameReader.request(defaultFramebufferObject(), pixelSize());
+    captureRequested = false;
+  }
+  QImage frame;
+  while (frameReader.poll(frame)) emit frameCaptured(frame);
+}
 
-  shaderProgram->bind();
-  shaderProgram->setUniformValue("mvp_matrix", transformationMatrix);
+void ViewerWidget::renderScaled(const ViewState &state) {
+  if (scaledBuffer && scaledBuffer->size() != state.size) {
+    delete scaledBuffer;
+    scaledBuffer = nullptr;
+  }
+  if (!scaledBuffer) {
+    scaledBuffer = new QOpenGLFramebufferObject(
+        state.size, QOpenGLFramebufferObject::CombinedDepthStencil);
+    glBindTexture(GL_TEXTURE_2D, scaledBuffer->texture());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+  }
+  scaledBuffer->bind();
+  renderer.render(state);
+  scaledBuffer->release();
+
+  QRect viewport(QPoint(0, 0), pixelSize());
+  glViewport(0, 0, viewport.width(), viewport.height());
+  blitter.bind();
+  blitter.blit(scaledBuffer->texture(),
+               QOpenGLTextureBlitter::targetTransform(QRectF(viewport),
+                                                      viewport),
+               QOpenGLTextureBlitter::OriginBottomLeft);
+  blitter.release();
+}
 
-  glBindBuffer(GL_ARRAY_BUFFER, VBO);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+void ViewerWidget::refresh() {
+  stateChanged = true;
+  update();
+}
 
-  GLint posAttrib = shaderProgram->attributeLocation("vertex_pos");
-  glVertexAttribPointer(posAttrib, 3, GL_FLOAT, GL_TRUE, sizeof(Vertex_t),
-                        nullptr);
-  glEnableVertexAttribArray(posAttrib);
+void ViewerWidget::queueTransformation(TransformationName_e type,
+                                       bool isMouse, float delta) {
+  float &pending = pendingInput[isMouse][type];
+  if (type == TransformationName_e::Scale) {
+    float factor = std::max(1 + pending, MIN_SCALE_FACTOR) *
+                   std::max(1 + delta, MIN_SCALE_FACTOR);
+    pending = factor - 1;
+  } else {
+    pending += delta;
+  }
+  if (!inputTime) inputTime = clock.nsecsElapsed();
+  beginInteraction();
+  refresh();
+}
 
-  drawEdges();
-  if (settings->value("verticesStyle").toInt()) drawVertices();
+void ViewerWidget::beginInteraction() {
+  interacting = true;
+  idleTimer.start(settings->data().idleDelay);
+}
 
-  glDisableVertexAttribArray(posAttrib);
-  glBindBuffer(GL_ARRAY_BUFFER, 0);
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+void ViewerWidget::endInteraction() {
+  interacting = false;
+  refresh();
+}
 
-  shaderProgram->release();
+void ViewerWidget::adaptQuality(qint64 frameTime) {
+  const RenderSettingsData &data = settings->data();
+  if (data.targetFps <= 0) {
+    detail = 1.0f;
+    resolutionScale = resolutionStep = 1.0f;
+    return;
+  }
+  float ratio = std::clamp(
+      1e9f / data.targetFps / std::max<qint64>(frameTime, 1), 0.5f,
+      DETAIL_GROWTH);
+  if (data.dynamicResolution) {
+    detail = std::clamp(detail * std::sqrt(ratio), MIN_DETAIL, 1.0f);
+    resolutionScale = std::clamp(resolutionScale * std::pow(ratio, 0.25f),
+                                 MIN_RESOLUTION_SCALE, 1.0f);
+    if (std::abs(resolutionScale - resolutionStep) >
+        RESOLUTION_SCALE_STEP * 0.75f) {
+      resolutionStep = std::max(
+          std::round(resolutionScale / RESOLUTION_SCALE_STEP) *
+              RESOLUTION_SCALE_STEP,
+          MIN_RESOLUTION_SCALE);
+    }
+  } else {
+    detail = std::clamp(detail * ratio, MIN_DETAIL, 1.0f);
+    resolutionScale = resolutionStep = 1.0f;
+  }
 }
 
-void ViewerWidget::updateTransformation() {
-  transformationMatrix.setToIdentity();
-  setProjection();
-  transformationMatrix.translate(0.0f, 0.0f, -2.0f);
-  transformationMatrix *= getTransformation();
+float ViewerWidget::steppedResolutionScale() const {
+  return interacting ? resolutionStep : 1.0f;
 }
 
-void ViewerWidget::setProjection() {
-  float aspect = static_cast<float>(width()) / height();
-  float nearPlane = 0.1f;
-  float farPlane = 100.0f;
-  float fov = 45.0f;
-
-  float top = tan((fov * M_PI / 360.0)) * nearPlane;
-  float bottom = -top;
-  float right = top * aspect;
-  float left = -right;
-
-  if (settings->value("isOrtho").toBool()) {
-    float aspectRatio = static_cast<float>(width()) / height();
-    transformationMatrix.ortho(-aspectRatio, aspectRatio, -1.0, 1.0, -1.0,
-                               100.0);
-  } else {
-    transformationMatrix.frustum(left, right, bottom, top, nearPlane, farPlane);
+void ViewerWidget::flushInput() {
+  std::vector<TransformationStep_t> steps;
+  for (bool isMouse : {false, true}) {
+    for (int type = 0; type < TRANSFORMATION_COUNT; ++type) {
+      float &pending = pendingInput[isMouse][type];
+      if (pending != 0.0f) {
+        steps.push_back(
+            {static_cast<TransformationName_e>(type), isMouse, pending});
+        pending = 0.0f;
+      }
+    }
   }
+  if (!steps.empty()) controller->applyTransformations(steps);
 }
 
-void ViewerWidget::drawVertices() {
-  if (settings->value("verticesStyle").toInt() == 1) {
-    glEnable(GL_POINT_SMOOTH);
-  } else {
-    glDisable(GL_POINT_SMOOTH);
+void ViewerWidget::onFrameSwapped() {
+  qint64 now = clock.nsecsElapsed();
+  if (frameInputTime) {
+    statistics.latency = (now - frameInputTime) / 1e6;
+    if (interacting) {
+      adaptQuality(static_cast<qint64>(statistics.cpuTime * 1e6));
+    }
+    frameInputTime = 0;
   }
-  shaderProgram->setUniformValue("isLine", false);
-  glPointSize(settings->value("verticesSize").toInt() / 2.0f);
-  shaderProgram->setUniformValue(
-      "color",
-      QVector4D(settings->value("verticesColorRed").toInt() / 255.0f,
-                settings->value("verticesColorGreen").toInt() / 255.0f,
-                settings->value("verticesColorBlue").toInt() / 255.0f, 1));
-
-  glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(getVerticesSize()));
+  statistics.detail = interacting ? detail : 1.0;
+  statistics.resolutionScale = steppedResolutionScale();
+  if (isDragging) {
+    ++fpsFrames;
+    if (now - fpsWindowStart >= FPS_WINDOW_NS) {
+      statistics.fps = fpsFrames * 1e9 / (now - fpsWindowStart);
+      fpsWindowStart = now;
+      fpsFrames = 0;
+    }
+  }
+  emit frameRendered(statistics);
 }
 
-void ViewerWidget::drawEdges() {
-  if (settings->value("edgesStyle").toInt()) {
-    shaderProgram->setUniformValue("isDashed", true);
-  } else {
-    shaderProgram->setUniformValue("isDashed", false);
+ViewState ViewerWidget::currentState() {
+  ViewState state;
+  state.settings = settings->data();
+  state.transformation = getTransformation();
+  state.size = pixelSize();
+  float scale = steppedResolutionScale();
+  if (scale < 1.0f) {
+    state.resolutionScale = scale;
+    QSize scaled = state.size * scale;
+    state.size = scaled.expandedTo(QSize(1, 1));
   }
-  shaderProgram->setUniformValue("isLine", true);
-  glLineWidth(settings->value("edgesSize").toInt() / 10.0f);
-  shaderProgram->setUniformValue(
-      "color",
-      QVector4D(settings->value("edgesColorRed").toInt() / 255.0f,
-                settings->value("edgesColorGreen").toInt() / 255.0f,
-                settings->value("edgesColorBlue").toInt() / 255.0f, 1));
-  glDrawElements(GL_LINES, getEdgesSize() * 2, GL_UNSIGNED_INT, nullptr);
-  glDisable(GL_LINE_STIPPLE);
+  state.inputTime = inputTime;
+  state.detail = interacting ? detail : 1.0f;
+  return state;
 }
 
+QSize ViewerWidget::pixelSize() const { return size() * devicePixelRatio(); }
+
 void ViewerWidget::mousePressEvent(QMouseEvent* event) {
   if (event->button() == Qt::LeftButton) {
     lastMousePos = event->position();
     isDragging = true;
+    fpsWindowStart = clock.nsecsElapsed();
+    fpsFrames = 0;
   }
   QWidget::mousePressEvent(event);
 }
@@ -175,26 +312,25 @@ void ViewerWidget::mouseMoveEvent(QMouseEvent* event) {
   if (isDragging) {
     QPointF currentMousePos = event->position();
     if (event->modifiers()) {
-      controller->applyTransformation(
+      queueTransformation(
           TransformationName_e::TranslationX, true,
           +(currentMousePos.x() - lastMousePos.x()) / width() *
               SENSITIVITY_TRANSLATION *
-              (settings->value("isOrtho").toBool() ? 1 : 1.1));
-      controller->applyTransformation(
+              (settings->data().isOrtho ? 1 : 1.1));
+      queueTransformation(
           TransformationName_e::TranslationY, true,
           -(currentMousePos.y() - lastMousePos.y()) / height() *
               SENSITIVITY_TRANSLATION *
-              (settings->value("isOrtho").toBool() ? 1 : 1.1));
+              (settings->data().isOrtho ? 1 : 1.1));
     } else {
-      controller->applyTransformation(
+      queueTransformation(
           TransformationName_e::RotateY, true,
           (currentMousePos.x() - lastMousePos.x()) * SENSITIVITY_ROTATION);
-      controller->applyTransformation(
+      queueTransformation(
           TransformationName_e::RotateX, true,
           (currentMousePos.y() - lastMousePos.y()) * SENSITIVITY_ROTATION);
     }
     lastMousePos = currentMousePos;
-    update();
   }
 }
 
@@ -209,52 +345,80 @@ void ViewerWidget::wheelEvent(QWheelEvent* event) {
   if (zoomFactor != 0) {
     float offsetX = -(event->position().x() - width() / 2.0f) / width();
     float offsetY = (event->position().y() - height() / 2.0f) / height();
-    controller->applyTransformation(
+    queueTransformation(
         TransformationName_e::TranslationX, true,
         offsetX * zoomFactor * SENSITIVITY_TRANSLATION *
-            (settings->value("isOrtho").toBool() ? 1 : 1.1));
-    controller->applyTransformation(
+            (settings->data().isOrtho ? 1 : 1.1));
+    queueTransformation(
         TransformationName_e::TranslationY, true,
         offsetY * zoomFactor * SENSITIVITY_TRANSLATION *
-            (settings->value("isOrtho").toBool() ? 1 : 1.1));
-    controller->applyTransformation(TransformationName_e::Scale, true,
-                                    zoomFactor);
+            (settings->data().isOrtho ? 1 : 1.1));
+    queueTransformation(TransformationName_e::Scale, true, zoomFactor);
   }
-  update();
 }
 
 void ViewerWidget::resetTransformation() {
+  std::fill(&pendingInput[0][0], &pendingInput[0][0] + 2 * TRANSFORMATION_COUNT,
+            0.0f);
   controller->clearTransformation();
-  update();
+  refresh();
 }
 
 void ViewerWidget::transformation(TransformationName_e transformation,
                                   float delta) {
-  controller->applyTransformation(transformation, false, delta);
-  update();
+  queueTransformation(transformation, false, delta);
 }
 
 QMatrix4x4 ViewerWidget::getTransformation() {
-  Matrix transf = controller->getTransformation();
-  QMatrix4x4 qTransformation =
-      QMatrix4x4(transf[0][0], transf[0][1], transf[0][2], transf[0][3],
-                 transf[1][0], transf[1][1], transf[1][2], transf[1][3],
-                 transf[2][0], transf[2][1], transf[2][2], transf[2][3],
-                 transf[3][0], transf[3][1], transf[3][2], transf[3][3]);
-
-  return qTransformation;
+  return Renderer::toQMatrix(controller->getTransformation());
 }
 
-std::size_t ViewerWidget::getVerticesSize() {
-  return controller->getVertices().size();
-}
+std::size_t ViewerWidget::getVerticesSize() { return modelInfo().vertices; }
+
+std::size_t ViewerWidget::getDisplayedSize() { return modelInfo().displayed; }
 
-std::size_t ViewerWidget::getEdgesSize() {
-  return controller->getEdges().size();
+std::size_t ViewerWidget::getEdgesSize() { return modelInfo().edges; }
+
+ModelInfo_t ViewerWidget::modelInfo() {
+  if (renderThread) {
+    QMutexLocker locker(&renderThread->geometryMutex());
+    return controller->getInfo();
+  }
+  return controller->getInfo();
 }
 
 QImage ViewerWidget::takeScreenshot() {
-  return grabFramebuffer().convertToFormat(QImage::Format_RGB32);
+  makeCurrent();
+  QImage frame = frameReader.read(defaultFramebufferObject(), pixelSize());
+  doneCurrent();
+  return frame;
+}
+
+void ViewerWidget::saveTiledScreenshot(const QString &path,
+                                       const QSize &size) {
+  ViewState state = currentState();
+  state.size = pixelSize();
+  state.resolutionScale = 1.0f;
+  if (renderThread) {
+    renderThread->requestTiled(state, size, path);
+    return;
+  }
+  makeCurrent();
+  bool saved = TiledRenderer(renderer).render(state, size, path);
+  doneCurrent();
+  emit tiledScreenshotSaved(path, saved);
+}
+
+void ViewerWidget::requestCapture() {
+  captureRequested = true;
+  update();
+}
+
+void ViewerWidget::stopCapture() {
+  captureRequested = false;
+  makeCurrent();
+  frameReader.discard();
+  doneCurrent();
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -13,24 +13,34 @@
 // OPENGL v2.1
 
 #include "../s21_gui_defines.h"
+#include "../s21_render_settings.h"
+#include "s21_frame_reader.h"
+#include "s21_render_thread.h"
+#include "s21_renderer.h"
 
 namespace s21 {
 
 /// @brief Класс openGL
 class ViewerWidget : public QOpenGLWidget, protected QOpenGLFunctions {
+  Q_OBJECT
  public:
   /// @brief конструктор
   /// @param parent указатель на родительский виджет
   /// @param set Указатель на настройки
-  explicit ViewerWidget(QWidget *parent = nullptr, QSettings *set = nullptr);
+  explicit ViewerWidget(QWidget *parent = nullptr,
+                        RenderSettings *set = nullptr);
   /// @brief деструктор
   ~ViewerWidget();
 
-  /// @brief Загрузка модели
+  /// @brief Загрузка модели. Поверхности сохраняются сразу, только если их
+  /// рисует текущий режим отображения, иначе читаются при первом запросе.
+  /// Если после неудачной загрузки модель пуста, ее буферы удаляются из
+  /// видеопамяти
   /// @param pathToFile путь к файлу
   /// @return Статус загрузки модели
   Status_e loadModel(QString pathToFile);
-  /// @brief сделать скриншот
+  /// @brief сделать скриншот. Кадр возвращается в формате чтения
+  /// framebuffer, преобразование остается потоку записи
   /// @return изображение
   QImage takeScreenshot();
   /// @brief сброс трансформации
@@ -42,9 +52,39 @@ class ViewerWidget : public QOpenGLWidget, protected QOpenGLFunctions {
   /// @brief получение размера вектора вершин
   /// @return кол-во вершин
   std::size_t getVerticesSize();
+  /// @brief получение кол-ва отображаемых вершин
+  /// @return кол-во вершин после прореживания облака точек
+  std::size_t getDisplayedSize();
   /// @brief получение размера вектора ребер
   /// @return кол-во ребер
   std::size_t getEdgesSize();
+  /// @brief Запрос перерисовки сцены с текущим состоянием
+  void refresh();
+  /// @brief Сохранение изображения произвольного размера, отрисованного по
+  /// плиткам. Результат приходит сигналом tiledScreenshotSaved
+  /// @param path Путь к файлу PNG
+  /// @param size Размер изображения
+  void saveTiledScreenshot(const QString &path, const QSize &size);
+  /// @brief Запрос асинхронного чтения следующего кадра, кадр приходит
+  /// сигналом frameCaptured через один-два кадра
+  void requestCapture();
+  /// @brief Отмена незавершенных чтений кадров
+  void stopCapture();
+
+ signals:
+  /// @brief Сигнал о выводе кадра на экран
+  /// @param statistics Статистика кадра
+  void frameRendered(const FrameStatistics &statistics);
+  /// @brief Сигнал о прочитанном кадре
+  /// @param frame Кадр в формате BGR
+  void frameCaptured(const QImage &frame);
+  /// @brief Сигнал о записи изображения, отрисованного по плиткам
+  /// @param path Путь к файлу
+  /// @param saved Файл записан
+  void tiledScreenshotSaved(const QString &path, bool saved);
+  /// @brief Сигнал об ошибке повторного чтения освобожденной геометрии
+  /// @param status Статус чтения
+  void geometryRestoreFailed(Status_e status);
 
  protected:
   /// @brief нажатие на кнопку мыши
@@ -74,25 +114,62 @@ class ViewerWidget : public QOpenGLWidget, protected QOpenGLFunctions {
   /// @brief Получить текущую матрицу трансформации.
   /// @return Объект QMatrix4x4, представляющий текущую трансформацию.
   QMatrix4x4 getTransformation();
-  /// @brief Инициализирует шейдерную программу для использования в OpenGL.
-  void initializeShader();
-  /// @brief Обновляет матрицу трансформации объекта.
-  void updateTransformation();
-  /// @brief Устанавливает проекцию для отображения сцены.
-  void setProjection();
-  /// @brief Отрисовывает вершины на экране с использованием текущих настроек.
-  void drawVertices();
-  /// @brief Отрисовывает рёбра на экране с использованием текущих настроек.
-  void drawEdges();
-  /// @brief Программа шейдера для отрисовки объектов.
-  QOpenGLShaderProgram *shaderProgram = nullptr;
-  /// @brief Идентификатор буфера вершин для OpenGL.
-  GLuint VBO;
-  /// @brief Идентификатор буфера элементов для OpenGL.
-  GLuint EBO;
-  /// @brief Матрица трансформации для управления положением и ориентацией
-  /// объекта.
-  QMatrix4x4 transformationMatrix;
+  /// @brief Собирает снимок состояния сцены для отрисовки
+  /// @return Состояние сцены
+  ViewState currentState();
+  /// @brief Загружает геометрию модели в видеопамять
+  void uploadGeometry();
+  /// @brief Повторное чтение освобожденной геометрии при смене настроек,
+  /// если новому режиму не хватает буферов в видеопамяти. Модель читается
+  /// один раз вне отрисовки кадра, при ошибке чтения буферы модели удаляются
+  /// из видеопамяти и отправляется сигнал geometryRestoreFailed
+  void restoreGeometry();
+  /// @brief Сведения о модели, не требующие ее геометрии
+  /// @return Копия сведений
+  ModelInfo_t modelInfo();
+  /// @brief Размер виджета в пикселях устройства
+  /// @return Размер
+  QSize pixelSize() const;
+  /// @brief Накопление трансформации до следующего кадра.
+  /// Шаг объединяется только с предыдущим шагом того же типа, так порядок
+  /// некоммутирующих трансформаций сохраняется. Кадр запрашивается через
+  /// update().
+  /// @param type Тип трансформации
+  /// @param isMouse Трансформация мышью
+  /// @param delta Величина трансформации
+  void queueTransformation(TransformationName_e type, bool isMouse,
+                           float delta);
+  /// @brief Применение накопленного ввода перед отрисовкой кадра в
+  /// постоянном порядке: клавиатура, затем мышь; сдвиги, масштаб, повороты
+  void flushInput();
+  /// @brief Подсчет задержки и частоты кадров после вывода кадра на экран
+  void onFrameSwapped();
+  /// @brief Начало или продление взаимодействия с упрощенной отрисовкой
+  void beginInteraction();
+  /// @brief Конец взаимодействия по простою ввода, модель рисуется целиком
+  void endInteraction();
+  /// @brief Подстройка доли деталей и разрешения под целевую частоту кадров.
+  /// На вход подается измеренное время отрисовки кадра, а не задержка от
+  /// ввода, которая включает ожидание vsync и очереди кадров. При включенном
+  /// динамическом разрешении поправка делится поровну между долей деталей и
+  /// площадью кадра.
+  /// @param frameTime Время отрисовки кадра, нс
+  void adaptQuality(qint64 frameTime);
+  /// @brief Масштаб разрешения текущего кадра
+  /// @return Шаг масштаба при взаимодействии, иначе 1
+  float steppedResolutionScale() const;
+  /// @brief Отрисовка в буфер пониженного разрешения и растяжение на окно
+  /// @param state Состояние сцены с уменьшенным размером
+  void renderScaled(const ViewState &state);
+
+  /// @brief Объект отрисовки сцены в потоке GUI
+  Renderer renderer;
+  /// @brief Поток отрисовки, если включен многопоточный режим
+  RenderThread *renderThread = nullptr;
+  /// @brief Вывод кадров потока отрисовки на экран
+  QOpenGLTextureBlitter blitter;
+  /// @brief Многопоточная отрисовка
+  bool threaded = false;
   /// @brief Контроллер, управляющий данными и логикой приложения.
   Controller *controller = nullptr;
   /// @brief Флаг, указывающий, производится ли в данный момент перетаскивание
@@ -100,9 +177,45 @@ class ViewerWidget : public QOpenGLWidget, protected QOpenGLFunctions {
   bool isDragging = false;
   /// @brief Последняя позиция курсора мыши для отслеживания перетаскивания.
   QPointF lastMousePos;
-  /// @brief Указатель на объект QSettings для управления настройками
-  /// приложения.
-  QSettings *settings = nullptr;
+  /// @brief Указатель на настройки отрисовки
+  RenderSettings *settings = nullptr;
+
+  /// @brief Накопленный с прошлого кадра ввод: по одному значению на тип
+  /// трансформации для клавиатуры [0] и мыши [1]. Сдвиги и повороты
+  /// суммируются, масштаб перемножается
+  float pendingInput[2][TRANSFORMATION_COUNT] = {};
+  /// @brief Часы для отметок времени ввода и кадров
+  QElapsedTimer clock;
+  /// @brief Время самого раннего неотрисованного ввода, нс
+  qint64 inputTime = 0;
+  /// @brief Время ввода, учтенного в последнем готовом кадре, нс
+  qint64 frameInputTime = 0;
+  /// @brief Состояние сцены изменилось с последней отправки в поток
+  bool stateChanged = true;
+  /// @brief Статистика последнего кадра
+  FrameStatistics statistics;
+  /// @brief Начало окна подсчета частоты кадров, нс
+  qint64 fpsWindowStart = 0;
+  /// @brief Кадров в текущем окне подсчета
+  int fpsFrames = 0;
+  /// @brief Идет взаимодействие, модель рисуется упрощенно
+  bool interacting = false;
+  /// @brief Доля ребер и вершин при взаимодействии, сохраняется между ними
+  float detail = 1.0f;
+  /// @brief Масштаб разрешения при взаимодействии без округления
+  float resolutionScale = 1.0f;
+  /// @brief Масштаб разрешения, округленный до шага RESOLUTION_SCALE_STEP.
+  /// Меняется, только когда resolutionScale уходит от него больше чем на
+  /// полшага с запасом, поэтому буфер кадра не пересоздается каждый кадр
+  float resolutionStep = 1.0f;
+  /// @brief Буфер кадра пониженного разрешения
+  QOpenGLFramebufferObject *scaledBuffer = nullptr;
+  /// @brief Таймер простоя ввода
+  QTimer idleTimer;
+  /// @brief Чтение кадров из framebuffer виджета
+  FrameReader frameReader;
+  /// @brief Запрошено чтение следующего кадра
+  bool captureRequested = false;
 };
 
 }  // namespace s21
@@ -2,7 +2,7 @@
 
 namespace s21 {
 
-ControlWidget::ControlWidget(QWidget *parent, QSettings *set)
+ControlWidget::ControlWidget(QWidget *parent, RenderSettings *set)
     : QWidget{parent}, settings(set) {
   createButtons();
   createLayout();
@@ -17,6 +17,7 @@ ControlWidget::~ControlWidget() {
   if (translateButton) translateButton->deleteLater();
   if (scaleButton) scaleButton->deleteLater();
   if (rotateButton) rotateButton->deleteLater();
+  if (qualityButton) qualityButton->deleteLater();
 }
 
 void ControlWidget::createButtons() {
@@ -26,6 +27,7 @@ void ControlWidget::createButtons() {
   translateButton = createButton("Translate");
   scaleButton = createButton("Scale");
   rotateButton = createButton("Roate");
+  qualityButton = createButton("Quality");
 
   connect(backgroundSettingsButton, &QPushButton::clicked, this,
           &ControlWidget::backgroundSettingsPressed);
@@ -39,6 +41,8 @@ void ControlWidget::createButtons() {
           &ControlWidget::scalePressed);
   connect(rotateButton, &QPushButton::clicked, this,
           &ControlWidget::rotatePressed);
+  connect(qualityButton, &QPushButton::clicked, this,
+          &ControlWidget::qualityPressed);
 }
 
 QPushButton *ControlWidget::createButton(const QString &text) {
@@ -56,6 +60,7 @@ void ControlWidget::createLayout() {
   layout->addWidget(translateButton);
   layout->addWidget(scaleButton);
   layout->addWidget(rotateButton);
+  layout->addWidget(qualityButton);
   layout->setSpacing(SPACING);
   layout->setContentsMargins(0, 0, 0, 0);
   layout->setAlignment(Qt::AlignHCenter | Qt::AlignVCenter);
@@ -66,8 +71,6 @@ void ControlWidget::initSignals() {
   if (mainWindow) {
     connect(this, &ControlWidget::switchToNewWidget, mainWindow,
             &MainWindow::setNewWidget);
-    connect(this, &ControlWidget::settingsChanged, mainWindow,
-            &MainWindow::updateFromSettings);
   }
 }
 
@@ -123,4 +126,11 @@ void ControlWidget::rotatePressed() {
   switchToNewWidget(newWidget);
 }
 
+void ControlWidget::qualityPressed() {
+  QWidget *newWidget =
+      new SettingsWidget(qobject_cast<QWidget *>(this->parent()->parent()),
+                         settings, Settings_e::Quality_e);
+  switchToNewWidget(newWidget);
+}
+
 }  // namespace s21
\ No newline at end of file
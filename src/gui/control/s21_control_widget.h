@@ -23,7 +23,8 @@ class ControlWidget : public QWidget {
   /// @brief Конструктор виджета управления
   /// @param parent Родительский виджет
   /// @param set Указатель на настройки
-  explicit ControlWidget(QWidget *parent = nullptr, QSettings *set = nullptr);
+  explicit ControlWidget(QWidget *parent = nullptr,
+                         RenderSettings *set = nullptr);
   /// @brief Деструктор виджета
   ~ControlWidget();
 
@@ -31,8 +32,6 @@ class ControlWidget : public QWidget {
   void setToDefault();
 
  signals:
-  /// @brief Сигнал изменения настроек
-  void settingsChanged();
   /// @brief Сигнал о смене виджета настроек
   /// @param newWidget Указатель на виджет настроек
   void switchToNewWidget(QWidget *newWidget);
@@ -64,9 +63,11 @@ class ControlWidget : public QWidget {
   void scalePressed();
   /// @brief Нажатие на кнопку вращения
   void rotatePressed();
+  /// @brief Нажатие на кнопку качества при взаимодействии
+  void qualityPressed();
 
   /// @brief Указатель на настройки
-  QSettings *settings;
+  RenderSettings *settings;
   /// @brief Указатель на кнопку фона
   QPushButton *backgroundSettingsButton = nullptr;
   /// @brief Указатель на кнопку вершин
@@ -79,6 +80,8 @@ class ControlWidget : public QWidget {
   QPushButton *scaleButton = nullptr;
   /// @brief Указатель на кнопку вращения
   QPushButton *rotateButton = nullptr;
+  /// @brief Указатель на кнопку качества при взаимодействии
+  QPushButton *qualityButton = nullptr;
   /// @brief Численные значения трансформаций уже применённых к модели
   int translateX, translateY, translateZ, scale, rotateX, rotateY, rotateZ;
 };
@@ -2,7 +2,7 @@
 
 namespace s21 {
 
-SettingsWidget::SettingsWidget(QWidget *parent, QSettings *set,
+SettingsWidget::SettingsWidget(QWidget *parent, RenderSettings *set,
                                const Settings_e &t, int *x, int *y, int *z)
     : QWidget{parent}, type(t), settings(set), first(x), second(y), third(z) {
   container = new QWidget(this);
@@ -38,8 +38,6 @@ SettingsWidget::~SettingsWidget() {
 void SettingsWidget::initSignals() {
   MainWindow *mainWindow = qobject_cast<MainWindow *>(parent());
   if (mainWindow) {
-    connect(this, &SettingsWidget::settingsChanged, mainWindow,
-            &MainWindow::updateFromSettings);
     connect(this, &SettingsWidget::changeTransformation, mainWindow,
             &MainWindow::updateTransformation);
   }
@@ -48,7 +46,10 @@ void SettingsWidget::initSignals() {
 void SettingsWidget::initSliders() {
   sliderFirst = createSlider();
   lineFirst = createLine();
-  if (type != Settings_e::Scale_e) {
+  if (type == Settings_e::Quality_e) {
+    sliderSecond = createSlider();
+    lineSecond = createLine();
+  } else if (type != Settings_e::Scale_e) {
     sliderSecond = createSlider();
     lineSecond = createLine();
     sliderThird = createSlider();
@@ -94,6 +95,11 @@ void SettingsWidget::initText() {
       mainText = createLabel("Rotate");
       initTransformText();
       break;
+    case Settings_e::Quality_e:
+      mainText = createLabel("Quality");
+      textFirst = createLabel("FPS");
+      textSecond = createLabel("Idle");
+      break;
   }
 }
 
@@ -207,6 +213,9 @@ void SettingsWidget::setupSliders() {
     case Settings_e::Rotate_e:
       rotateSliders();
       break;
+    case Settings_e::Quality_e:
+      qualitySliders();
+      break;
   }
 }
 
@@ -222,11 +231,13 @@ void SettingsWidget::setupComboBox() {
     case Settings_e::Translate_e:
     case Settings_e::Scale_e:
     case Settings_e::Rotate_e:
+    case Settings_e::Quality_e:
       break;
   }
 }
 
 void SettingsWidget::updateDisplayColor() {
+  if (!displayColor) return;
   int red = sliderFirst->value();
   int green = sliderSecond->value();
   int blue = sliderThird->value();
@@ -242,23 +253,34 @@ void SettingsWidget::updateDisplayColor() {
 }
 
 void SettingsWidget::verticesSliders() {
-  connectSlider(sliderFirst, lineFirst, "verticesColorRed", 0, 255);
-  connectSlider(sliderSecond, lineSecond, "verticesColorGreen", 0, 255);
-  connectSlider(sliderThird, lineThird, "verticesColorBlue", 0, 255);
-  connectSlider(sliderFourth, lineFourth, "verticesSize", 0, 100);
+  connectSlider(sliderFirst, lineFirst,
+                &RenderSettingsData::verticesColorRed, 0, 255);
+  connectSlider(sliderSecond, lineSecond,
+                &RenderSettingsData::verticesColorGreen, 0, 255);
+  connectSlider(sliderThird, lineThird,
+                &RenderSettingsData::verticesColorBlue, 0, 255);
+  connectSlider(sliderFourth, lineFourth,
+                &RenderSettingsData::verticesSize, 0, 100);
 }
 
 void SettingsWidget::backgroundSlides() {
-  connectSlider(sliderFirst, lineFirst, "backgroundColorRed", 0, 255);
-  connectSlider(sliderSecond, lineSecond, "backgroundColorGreen", 0, 255);
-  connectSlider(sliderThird, lineThird, "backgroundColorBlue", 0, 255);
+  connectSlider(sliderFirst, lineFirst,
+                &RenderSettingsData::backgroundColorRed, 0, 255);
+  connectSlider(sliderSecond, lineSecond,
+                &RenderSettingsData::backgroundColorGreen, 0, 255);
+  connectSlider(sliderThird, lineThird,
+                &RenderSettingsData::backgroundColorBlue, 0, 255);
 }
 
 void SettingsWidget::edgesSliders() {
-  connectSlider(sliderFirst, lineFirst, "edgesColorRed", 0, 255);
-  connectSlider(sliderSecond, lineSecond, "edgesColorGreen", 0, 255);
-  connectSlider(sliderThird, lineThird, "edgesColorBlue", 0, 255);
-  connectSlider(sliderFourth, lineFourth, "edgesSize", 0, 100);
+  connectSlider(sliderFirst, lineFirst,
+                &RenderSettingsData::edgesColorRed, 0, 255);
+  connectSlider(sliderSecond, lineSecond,
+                &RenderSettingsData::edgesColorGreen, 0, 255);
+  connectSlider(sliderThird, lineThird,
+                &RenderSettingsData::edgesColorBlue, 0, 255);
+  connectSlider(sliderFourth, lineFourth,
+                &RenderSettingsData::edgesSize, 0, 100);
 }
 void SettingsWidget::translateSlider() {
   connectSlider(sliderFirst, lineFirst, first, -100, 100, 10,
@@ -282,30 +304,35 @@ void SettingsWidget::rotateSliders() {
                 TransformationName_e::RotateZ);
 }
 
+void SettingsWidget::qualitySliders() {
+  connectSlider(sliderFirst, lineFirst, &RenderSettingsData::targetFps, 0,
+                MAX_TARGET_FPS);
+  connectSlider(sliderSecond, lineSecond, &RenderSettingsData::idleDelay, 0,
+                MAX_IDLE_DELAY);
+}
+
 void SettingsWidget::connectSlider(QSlider *slider, QLineEdit *line,
-                                   const QString &key, const int &min,
+                                   IntSetting field, const int &min,
                                    const int &max) {
   slider->setMinimum(min);
   slider->setMaximum(max);
-  slider->setValue(settings->value(key).toInt());
-  line->setText(QString::number(settings->value(key).toInt()));
+  slider->setValue(settings->value(field));
+  line->setText(QString::number(settings->value(field)));
 
-  connect(slider, &QSlider::valueChanged, line, [line, this, key](int value) {
+  connect(slider, &QSlider::valueChanged, line, [line, this, field](int value) {
     line->setText(QString::number(value));
-    settings->setValue(key, value);
+    settings->setValue(field, value);
     updateDisplayColor();
-    emit settingsChanged();
   });
 
   connect(line, &QLineEdit::textChanged, slider,
-          [slider, this, key](const QString &text) {
+          [slider, this, field](const QString &text) {
             bool ok;
             int value = text.toInt(&ok);
             if (ok) {
               slider->setValue(value);
-              settings->setValue(key, value);
+              settings->setValue(field, value);
               updateDisplayColor();
-              emit settingsChanged();
             }
           });
 }
@@ -344,21 +371,21 @@ void SettingsWidget::verticesComboBox() {
   comboBox->addItem("None");
   comboBox->addItem("Rounds");
   comboBox->addItem("Squares");
-  connectComboBox(comboBox, "verticesStyle");
+  connectComboBox(comboBox, &RenderSettingsData::verticesStyle);
 }
 
 void SettingsWidget::edgesComboBox() {
   comboBox->addItem("Solid");
   comboBox->addItem("Dashed");
-  connectComboBox(comboBox, "edgesStyle");
+  comboBox->addItem("Triangles");
+  comboBox->addItem("Hidden line");
+  connectComboBox(comboBox, &RenderSettingsData::edgesStyle);
 }
 
-void SettingsWidget::connectComboBox(QComboBox *box, const QString &key) {
-  box->setCurrentIndex(settings->value(key).toInt());
-  connect(box, &QComboBox::currentIndexChanged, [this, key](int index) {
-    settings->setValue(key, index);
-    emit settingsChanged();
-  });
+void SettingsWidget::connectComboBox(QComboBox *box, IntSetting field) {
+  box->setCurrentIndex(settings->value(field));
+  connect(box, &QComboBox::currentIndexChanged,
+          [this, field](int index) { settings->setValue(field, index); });
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -22,7 +22,8 @@ enum Settings_e {
   Edges_e,
   Translate_e,
   Scale_e,
-  Rotate_e
+  Rotate_e,
+  Quality_e
 };
 
 /// @brief Класс виджета настроек
@@ -36,15 +37,13 @@ class SettingsWidget : public QWidget {
   /// @param x указатель на перемещение
   /// @param y указатель на перемещение
   /// @param z указатель на перемещение
-  SettingsWidget(QWidget *parent = nullptr, QSettings *set = nullptr,
+  SettingsWidget(QWidget *parent = nullptr, RenderSettings *set = nullptr,
                  const Settings_e &t = Settings_e::Background_e,
                  int *x = nullptr, int *y = nullptr, int *z = nullptr);
   /// @brief Деструктор
   ~SettingsWidget();
 
  signals:
-  /// @brief сигнал об изменении настроек
-  void settingsChanged();
   /// @brief Сигнал о трансформации
   /// @param transformation тип трансформации
   /// @param delta Изменение трансформации
@@ -95,14 +94,16 @@ class SettingsWidget : public QWidget {
   void scaleSliders();
   /// @brief слайдер вращения
   void rotateSliders();
+  /// @brief слайдеры целевой частоты кадров и простоя ввода
+  void qualitySliders();
 
   /// @brief коннект слайдеров
   /// @param slider указатель на слайдер
   /// @param line указатель на лайнедит
-  /// @param key Ключ настроек
+  /// @param field Поле настроек
   /// @param min Минимальное значение
   /// @param max Максимальное значение
-  void connectSlider(QSlider *slider, QLineEdit *line, const QString &key,
+  void connectSlider(QSlider *slider, QLineEdit *line, IntSetting field,
                      const int &min, const int &max);
 
   /// @brief коннект слайдеров
@@ -125,8 +126,8 @@ class SettingsWidget : public QWidget {
   void edgesComboBox();
   /// @brief коннект комбобокса
   /// @param box указатель на комбобокс
-  /// @param key ключ из настроек
-  void connectComboBox(QComboBox *box, const QString &key);
+  /// @param field поле настроек
+  void connectComboBox(QComboBox *box, IntSetting field);
   /// @brief создание выкладки виджетов
   void createLayout();
   /// @brief Сбор 3 виджетов в 1 лэйаут
@@ -162,7 +163,7 @@ class SettingsWidget : public QWidget {
   /// @brief Виджет с активным цветом
   QWidget *displayColor = nullptr;
   /// @brief указатель на настройки
-  QSettings *settings = nullptr;
+  RenderSettings *settings = nullptr;
   /// @brief текст
   QLabel *textFirst = nullptr;
   /// @brief текст
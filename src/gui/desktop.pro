@@ -8,38 +8,82 @@ QMAKE_CXXFLAGS += -Wall -Werror -Wextra
 TARGET = 3DViewer
 
 CONFIG += link_pkgconfig
-PKGCONFIG += opencv4
+PKGCONFIG += opencv4 zlib
 
 ICON = icon/icon.ico
 
 SOURCES += \
     s21_engine.cc \
     s21_frontend.cc \
+    s21_render_settings.cc \
     menu/s21_menu_widget.cc \
     OpenGL/s21_viewer_widget.cc \
+    OpenGL/s21_renderer.cc \
+    OpenGL/s21_frame_reader.cc \
+    OpenGL/s21_offline_renderer.cc \
+    OpenGL/s21_render_thread.cc \
+    OpenGL/s21_tiled_renderer.cc \
+    OpenGL/s21_gl_state_cache.cc \
     control/s21_control_widget.cc \
     control/s21_settings_widget.cc \
     infortmation/s21_information_widget.cc \
+    image/s21_image_saver.cc \
+    image/s21_image_writer.cc \
+    image/s21_png_writer.cc \
+    video/s21_avi_writer.cc \
+    video/s21_gif_palette.cc \
+    video/s21_gif_writer.cc \
+    video/s21_video_encoder.cc \
     ../controller/s21_controller.cc \
     ../backend/s21_backend.cc \
     ../backend/matrix/s21_matrix.cc \
     ../backend/model/s21_model.cc \
+    ../backend/render/s21_software_renderer.cc \
+    ../backend/image/s21_qoi.cc \
+    ../backend/mesh/s21_mesh.cc \
+    ../backend/mesh/s21_clusters.cc \
+    ../backend/mesh/s21_voxel_grid.cc \
+    ../backend/transform/s21_animation.cc \
     ../backend/transform/s21_transform.cc
 
 HEADERS += \
     s21_frontend.h \
     s21_gui_defines.h \
+    s21_render_settings.h \
     menu/s21_menu_widget.h \
     OpenGL/s21_viewer_widget.h \
+    OpenGL/s21_renderer.h \
+    OpenGL/s21_frame_reader.h \
+    OpenGL/s21_offline_renderer.h \
+    OpenGL/s21_render_thread.h \
+    OpenGL/s21_tiled_renderer.h \
+    OpenGL/s21_gl_state_cache.h \
     control/s21_control_widget.h \
     control/s21_settings_widget.h \
     infortmation/s21_information_widget.h \
+    image/s21_image_saver.h \
+    image/s21_image_writer.h \
+    image/s21_png_writer.h \
+    video/s21_avi_writer.h \
+    video/s21_gif_palette.h \
+    video/s21_gif_writer.h \
+    video/s21_video_encoder.h \
     ../controller/s21_controller.h \
     ../backend/s21_backend.h \
     ../backend/matrix/s21_matrix.h \
     ../backend/model/s21_model.h \
+    ../backend/render/s21_software_renderer.h \
+    ../backend/image/s21_qoi.h \
+    ../backend/mesh/s21_mesh.h \
+    ../backend/mesh/s21_clusters.h \
+    ../backend/mesh/s21_voxel_grid.h \
+    ../backend/transform/s21_animation.h \
     ../backend/transform/s21_transform.h \
-    ../common/s21_common.h
+    ../common/s21_common.h \
+    ../common/s21_memory.h \
+    ../common/s21_parallel.h \
+    ../common/s21_spsc_queue.h \
+    ../common/s21_thread_pool.h
 
 RESOURCES += resources.qrc
 
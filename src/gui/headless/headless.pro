@@ -0,0 +1,65 @@
+QT       += core gui widgets opengl openglwidgets
+
+
+CONFIG += c++17 console
+CONFIG -= app_bundle
+
+QMAKE_CXXFLAGS += -Wall -Werror -Wextra
+
+TARGET = 3DViewerCli
+
+CONFIG += link_pkgconfig
+PKGCONFIG += zlib
+
+SOURCES += \
+    s21_cli.cc \
+    s21_headless_renderer.cc \
+    ../s21_render_settings.cc \
+    ../OpenGL/s21_renderer.cc \
+    ../OpenGL/s21_frame_reader.cc \
+    ../OpenGL/s21_gl_state_cache.cc \
+    ../image/s21_image_writer.cc \
+    ../image/s21_png_writer.cc \
+    ../../controller/s21_controller.cc \
+    ../../backend/s21_backend.cc \
+    ../../backend/matrix/s21_matrix.cc \
+    ../../backend/model/s21_model.cc \
+    ../../backend/render/s21_software_renderer.cc \
+    ../../backend/image/s21_qoi.cc \
+    ../../backend/mesh/s21_mesh.cc \
+    ../../backend/mesh/s21_clusters.cc \
+    ../../backend/mesh/s21_voxel_grid.cc \
+    ../../backend/transform/s21_animation.cc \
+    ../../backend/transform/s21_transform.cc
+
+HEADERS += \
+    s21_headless_renderer.h \
+    ../s21_gui_defines.h \
+    ../s21_render_settings.h \
+    ../OpenGL/s21_renderer.h \
+    ../OpenGL/s21_frame_reader.h \
+    ../OpenGL/s21_gl_state_cache.h \
+    ../image/s21_image_writer.h \
+    ../image/s21_png_writer.h \
+    ../../controller/s21_controller.h \
+    ../../backend/s21_backend.h \
+    ../../backend/matrix/s21_matrix.h \
+    ../../backend/model/s21_model.h \
+    ../../backend/render/s21_software_renderer.h \
+    ../../backend/image/s21_qoi.h \
+    ../../backend/mesh/s21_mesh.h \
+    ../../backend/mesh/s21_clusters.h \
+    ../../backend/mesh/s21_voxel_grid.h \
+    ../../backend/transform/s21_animation.h \
+    ../../backend/transform/s21_transform.h \
+    ../../common/s21_common.h \
+    ../../common/s21_memory.h \
+    ../../common/s21_parallel.h \
+    ../../common/s21_spsc_queue.h \
+    ../../common/s21_thread_pool.h
+
+RESOURCES += ../resources.qrc
+
+qnx: target.path = /tmp/$${TARGET}/bin
+else: unix:!android: target.path = /opt/$${TARGET}/bin
+!isEmpty(target.path): INSTALLS += target
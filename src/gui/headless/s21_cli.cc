@@ -0,0 +1,284 @@
+#include <QCommandLineParser>
+#include <QGuiApplication>
+
+#include "../image/s21_image_writer.h"
+#include "s21_headless_renderer.h"
+
+/// @brief Коды завершения
+enum CliExit_e {
+  CliOk_e,
+  CliUsage_e,
+  CliModel_e,
+  CliContext_e,
+  CliWrite_e,
+  CliMismatch_e
+};
+
+namespace {
+
+/// @brief Поиск значения в списке имен
+/// @param value Значение флага
+/// @param names Допустимые имена по порядку значений перечисления
+/// @param result Номер имени
+/// @return false, если имя не найдено
+bool parseName(const QString &value, const QStringList &names, int &result) {
+  int index = names.indexOf(value.toLower());
+  if (index >= 0) result = index;
+  return index >= 0;
+}
+
+/// @brief Разбор цвета вида "R,G,B"
+/// @param value Значение флага
+/// @param red Красная компонента
+/// @param green Зеленая компонента
+/// @param blue Синяя компонента
+/// @return false, если формат неверный
+bool parseColor(const QString &value, int &red, int &green, int &blue) {
+  QStringList parts = value.split(',');
+  if (parts.size() != 3) return false;
+  int channels[3];
+  for (int i = 0; i < 3; ++i) {
+    bool ok = false;
+    channels[i] = parts[i].trimmed().toInt(&ok);
+    if (!ok || channels[i] < 0 || channels[i] > 255) return false;
+  }
+  red = channels[0];
+  green = channels[1];
+  blue = channels[2];
+  return true;
+}
+
+/// @brief Разбор размера вида "WxH"
+/// @param value Значение флага
+/// @param size Размер
+/// @return false, если формат неверный
+bool parseSize(const QString &value, QSize &size) {
+  QStringList parts = value.toLower().split('x');
+  bool okW = false;
+  bool okH = false;
+  if (parts.size() == 2) {
+    size = QSize(parts[0].toInt(&okW), parts[1].toInt(&okH));
+  }
+  return okW && okH && !size.isEmpty();
+}
+
+/// @brief Разбор целого неотрицательного числа
+/// @param value Значение флага
+/// @param result Число
+/// @return false, если формат неверный
+bool parseCount(const QString &value, int &result) {
+  bool ok = false;
+  int parsed = value.toInt(&ok);
+  if (ok && parsed >= 0) result = parsed;
+  return ok && parsed >= 0;
+}
+
+/// @brief Формат файла по расширению
+/// @param path Путь к файлу
+/// @param format Формат
+/// @return false, если расширение не поддерживается
+bool formatFromPath(const QString &path, s21::ImageFormat_e &format) {
+  for (int i = 0; i < s21::ImageFormat_e::ImageFormats_e; ++i) {
+    s21::ImageFormat_e candidate = static_cast<s21::ImageFormat_e>(i);
+    if (path.endsWith(s21::ImageWriter::extension(candidate),
+                      Qt::CaseInsensitive)) {
+      format = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+/// @brief Разбор флагов в задание отрисовки
+/// @param parser Разобранная командная строка
+/// @param job Задание
+/// @return Текст ошибки, пустой при успехе
+QString parseJob(const QCommandLineParser &parser, s21::HeadlessJob_t &job) {
+  s21::RenderSettingsData &settings = job.settings;
+  if (parser.isSet("size") && !parseSize(parser.value("size"), job.size)) {
+    return "неверный размер " + parser.value("size");
+  }
+  if (parser.isSet("transform") &&
+      !s21::parseTransformations(parser.value("transform").toStdString(),
+                                 job.steps)) {
+    return "неверная трансформация " + parser.value("transform");
+  }
+  if (parser.isSet("projection")) {
+    int projection = 0;
+    if (!parseName(parser.value("projection"), {"perspective", "ortho"},
+                   projection)) {
+      return "неверная проекция " + parser.value("projection");
+    }
+    settings.isOrtho = projection == 1;
+  }
+  if (parser.isSet("background") &&
+      !parseColor(parser.value("background"), settings.backgroundColorRed,
+                  settings.backgroundColorGreen,
+                  settings.backgroundColorBlue)) {
+    return "неверный цвет фона " + parser.value("background");
+  }
+  if (parser.isSet("vertex-color") &&
+      !parseColor(parser.value("vertex-color"), settings.verticesColorRed,
+                  settings.verticesColorGreen, settings.verticesColorBlue)) {
+    return "неверный цвет вершин " + parser.value("vertex-color");
+  }
+  if (parser.isSet("edge-color") &&
+      !parseColor(parser.value("edge-color"), settings.edgesColorRed,
+                  settings.edgesColorGreen, settings.edgesColorBlue)) {
+    return "неверный цвет ребер " + parser.value("edge-color");
+  }
+  if (parser.isSet("vertex-size") &&
+      !parseCount(parser.value("vertex-size"), settings.verticesSize)) {
+    return "неверный размер вершин " + parser.value("vertex-size");
+  }
+  if (parser.isSet("edge-size") &&
+      !parseCount(parser.value("edge-size"), settings.edgesSize)) {
+    return "неверная толщина ребер " + parser.value("edge-size");
+  }
+  if (parser.isSet("vertex-style") &&
+      !parseName(parser.value("vertex-style"), {"none", "round", "square"},
+                 settings.verticesStyle)) {
+    return "неверный стиль вершин " + parser.value("vertex-style");
+  }
+  if (parser.isSet("edge-style") &&
+      !parseName(parser.value("edge-style"),
+                 {"solid", "dashed", "triangles", "hidden"},
+                 settings.edgesStyle)) {
+    return "неверный стиль ребер " + parser.value("edge-style");
+  }
+  if (parser.isSet("display") &&
+      !parseName(parser.value("display"),
+                 {"wireframe", "surface", "surface-edges"},
+                 settings.displayMode)) {
+    return "неверный режим отображения " + parser.value("display");
+  }
+  if (parser.isSet("point-cloud") &&
+      !parseCount(parser.value("point-cloud"),
+                  settings.pointCloudResolution)) {
+    return "неверное разрешение облака точек " + parser.value("point-cloud");
+  }
+  return QString();
+}
+
+/// @brief Описание флагов командной строки
+/// @param parser Парсер
+void addOptions(QCommandLineParser &parser) {
+  parser.setApplicationDescription(
+      "Отрисовка модели в изображение без окна. Настройки берутся из "
+      "флагов, сохраненные настройки окна просмотра не читаются.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("model", "Файл модели OBJ");
+  parser.addPositionalArgument(
+      "output", "Изображение: .png, .qoi, .bmp, .ppm или .jpg");
+  parser.addOptions({
+      {{"s", "size"}, "Размер изображения", "WxH"},
+      {{"t", "transform"},
+       "Трансформации по порядку: tx, ty, tz, rx, ry, rz в градусах, s - "
+       "множитель",
+       "rx=30,ry=45,s=1.5"},
+      {"projection", "Проекция: ortho или perspective", "mode"},
+      {"background", "Цвет фона", "R,G,B"},
+      {"vertex-color", "Цвет вершин", "R,G,B"},
+      {"edge-color", "Цвет ребер", "R,G,B"},
+      {"vertex-size", "Размер вершин", "px"},
+      {"edge-size", "Толщина ребер", "px"},
+      {"vertex-style", "Стиль вершин: none, round, square", "style"},
+      {"edge-style", "Стиль ребер: solid, dashed, triangles, hidden",
+       "style"},
+      {"display", "Режим: wireframe, surface, surface-edges", "mode"},
+      {"point-cloud", "Вокселей по оси облака точек, 0 - все точки",
+       "count"},
+      {"quality", "Качество JPEG", "0-100"},
+      {"golden", "Эталон для сравнения, при отличии код выхода 5", "file"},
+      {"tolerance", "Допустимая разница каналов при сравнении", "value"},
+      {"legacy-gl",
+       "OpenGL 2.1 вместо 3.3 Core, без контекста код выхода 3"},
+      {"software",
+       "Программная отрисовка Mesa llvmpipe, без контекста код выхода 3"},
+      {"cpu", "Отрисовка каркаса на процессоре без openGL"},
+  });
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    if (qstrcmp(argv[i], "--software") == 0) {
+      qputenv("LIBGL_ALWAYS_SOFTWARE", "1");
+    } else if (qstrcmp(argv[i], "--legacy-gl") == 0) {
+      qputenv("S21_LEGACY_GL", "1");
+    }
+  }
+  if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+  QGuiApplication app(argc, argv);
+  QCoreApplication::setApplicationName("3DViewerCli");
+  Q_INIT_RESOURCE(resources);
+
+  QCommandLineParser parser;
+  addOptions(parser);
+  parser.process(app);
+  QStringList files = parser.positionalArguments();
+  s21::HeadlessJob_t job;
+  s21::ImageFormat_e format = s21::ImageFormat_e::Png_e;
+  int quality = SCREENSHOT_JPEG_QUALITY;
+  int tolerance = 0;
+  QString error;
+  if (files.size() != 2) {
+    error = "нужны пути к модели и изображению";
+  } else if (!formatFromPath(files[1], format)) {
+    error = "неизвестный формат " + files[1];
+  } else if (parser.isSet("quality") &&
+             !parseCount(parser.value("quality"), quality)) {
+    error = "неверное качество " + parser.value("quality");
+  } else if (parser.isSet("tolerance") &&
+             !parseCount(parser.value("tolerance"), tolerance)) {
+    error = "неверный допуск " + parser.value("tolerance");
+  } else {
+    error = parseJob(parser, job);
+  }
+  if (!error.isEmpty()) {
+    qCritical().noquote() << error;
+    parser.showHelp(CliUsage_e);
+  }
+  job.model = files[0];
+
+  QImage image;
+  s21::Status_e status = s21::Status_e::OK;
+  bool cpu = parser.isSet("cpu");
+  if (!cpu) {
+    QSurfaceFormat::setDefaultFormat(s21::Renderer::preferredFormat());
+    s21::HeadlessRenderer renderer;
+    if (!renderer.isValid() || !renderer.render(job, image, status)) {
+      if (parser.isSet("software") || parser.isSet("legacy-gl")) {
+        qCritical() << "Не удалось создать контекст openGL";
+        return CliContext_e;
+      }
+      qWarning() << "Не удалось создать контекст openGL, отрисовка на "
+                    "процессоре";
+      cpu = true;
+    }
+  }
+  if (cpu) status = s21::HeadlessRenderer::renderSoftware(job, image);
+  if (status != s21::Status_e::OK) {
+    qCritical().noquote() << "Не удалось открыть модель" << job.model;
+    return CliModel_e;
+  }
+  if (!s21::ImageWriter::write(image, files[1], format, quality)) {
+    qCritical().noquote() << "Не удалось сохранить" << files[1];
+    return CliWrite_e;
+  }
+  if (parser.isSet("golden")) {
+    qint64 different = s21::HeadlessRenderer::compare(
+        image, QImage(parser.value("golden")), tolerance);
+    if (different != 0) {
+      qCritical().noquote() << "Отличие от эталона:"
+                            << (different < 0 ? QString("размер")
+                                              : QString::number(different))
+                            << parser.value("golden");
+      return CliMismatch_e;
+    }
+  }
+  return CliOk_e;
+}
\ No newline at end of file
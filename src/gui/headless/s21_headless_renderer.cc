@@ -0,0 +1,150 @@
+#include "s21_headless_renderer.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Перевод цвета настроек в RGB
+/// @param red Красная компонента
+/// @param green Зеленая компонента
+/// @param blue Синяя компонента
+/// @param color Цвет RGB
+void toColor(int red, int green, int blue, std::uint8_t color[3]) {
+  color[0] = static_cast<std::uint8_t>(std::clamp(red, 0, 255));
+  color[1] = static_cast<std::uint8_t>(std::clamp(green, 0, 255));
+  color[2] = static_cast<std::uint8_t>(std::clamp(blue, 0, 255));
+}
+
+}  // namespace
+
+HeadlessRenderer::HeadlessRenderer() {
+  surface = new QOffscreenSurface();
+  surface->setFormat(QSurfaceFormat::defaultFormat());
+  surface->create();
+
+  context = new QOpenGLContext();
+  context->setFormat(QSurfaceFormat::defaultFormat());
+  if (!context->create()) {
+    qDebug() << "Не удалось создать контекст отрисовки без окна";
+  }
+}
+
+HeadlessRenderer::~HeadlessRenderer() {
+  delete context;
+  context = nullptr;
+  surface->destroy();
+  delete surface;
+  surface = nullptr;
+}
+
+bool HeadlessRenderer::isValid() const {
+  return context->isValid() && surface->isValid();
+}
+
+bool HeadlessRenderer::render(const HeadlessJob_t &job, QImage &image,
+                              Status_e &status) {
+  image = QImage();
+  Controller controller;
+  controller.setPointCloudResolution(
+      std::max(0, job.settings.pointCloudResolution));
+  status = controller.loadModel(job.model.toStdString(),
+                                job.settings.loadOptions());
+  if (status != Status_e::OK) return true;
+  if (!context->makeCurrent(surface)) return false;
+  controller.clearTransformation();
+  controller.applyTransformations(job.steps);
+
+  QSize size = job.size.expandedTo(QSize(1, 1));
+  Renderer renderer;
+  renderer.initialize();
+  FrameReader reader;
+  reader.initialize();
+  QOpenGLFramebufferObject buffer(
+      size, QOpenGLFramebufferObject::CombinedDepthStencil);
+
+  ViewState state;
+  state.size = size;
+  state.settings = job.settings;
+  state.transformation = Renderer::toQMatrix(controller.getTransformation());
+  renderer.uploadModel(controller.getDisplayVertices(),
+                       controller.getEdgeStrips());
+  while (renderer.prepare(state, controller)) {
+  }
+  buffer.bind();
+  renderer.render(state);
+  image = reader.read(buffer.handle(), size);
+  buffer.release();
+  reader.cleanup();
+  renderer.cleanup();
+  context->doneCurrent();
+  return true;
+}
+
+Status_e HeadlessRenderer::renderSoftware(const HeadlessJob_t &job,
+                                          QImage &image) {
+  image = QImage();
+  const RenderSettingsData &settings = job.settings;
+  Controller controller;
+  controller.setPointCloudResolution(
+      std::max(0, settings.pointCloudResolution));
+  Status_e status = controller.loadModel(job.model.toStdString(),
+                                         settings.loadOptions());
+  if (status != Status_e::OK) return status;
+  controller.clearTransformation();
+  controller.applyTransformations(job.steps);
+  if (settings.displayMode != DisplayMode_e::Wireframe_e) {
+    qWarning() << "Программная отрисовка рисует только каркас";
+  }
+
+  RasterSettings_t raster;
+  raster.isOrtho = settings.isOrtho;
+  toColor(settings.backgroundColorRed, settings.backgroundColorGreen,
+          settings.backgroundColorBlue, raster.background);
+  toColor(settings.edgesColorRed, settings.edgesColorGreen,
+          settings.edgesColorBlue, raster.edgeColor);
+  toColor(settings.verticesColorRed, settings.verticesColorGreen,
+          settings.verticesColorBlue, raster.vertexColor);
+  raster.lineWidth = settings.lineWidth();
+  bool points = settings.verticesStyle || controller.isPointCloud();
+  raster.pointSize = points ? std::max(1.0f, settings.pointSize()) : 0.0f;
+  raster.roundPoints = settings.verticesStyle == 1;
+
+  QSize size = job.size.expandedTo(QSize(1, 1));
+  SoftwareRenderer renderer;
+  renderer.resize(size.width(), size.height());
+  QElapsedTimer timer;
+  timer.start();
+  renderer.render(controller.getDisplayVertices(), controller.getEdgeStrips(),
+                  controller.getTransformation(), raster);
+  double milliseconds = timer.nsecsElapsed() / 1e6;
+  qInfo() << "Программная отрисовка:" << renderer.getEdgeCount()
+          << "ребер за" << milliseconds << "мс";
+  image = QImage(renderer.getPixels().data(), renderer.getWidth(),
+                 renderer.getHeight(), renderer.getWidth() * 3,
+                 QImage::Format_RGB888)
+              .copy();
+  return status;
+}
+
+qint64 HeadlessRenderer::compare(const QImage &image, const QImage &golden,
+                                 int tolerance) {
+  if (image.size() != golden.size()) return -1;
+  QImage a = image.convertToFormat(QImage::Format_RGB888);
+  QImage b = golden.convertToFormat(QImage::Format_RGB888);
+  qint64 different = 0;
+  for (int y = 0; y < a.height(); ++y) {
+    const uchar *rowA = a.constScanLine(y);
+    const uchar *rowB = b.constScanLine(y);
+    for (int x = 0; x < a.width() * 3; x += 3) {
+      int difference = 0;
+      for (int channel = 0; channel < 3; ++channel) {
+        difference = std::max(
+            difference, std::abs(rowA[x + channel] - rowB[x + channel]));
+      }
+      if (difference > tolerance) ++different;
+    }
+  }
+  return different;
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,83 @@
+/// @mainpage
+/// @file s21_headless_renderer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_HEADLESS_RENDERER_H
+#define S21_HEADLESS_RENDERER_H
+
+#include "../OpenGL/s21_frame_reader.h"
+#include "../OpenGL/s21_renderer.h"
+#include "../s21_gui_defines.h"
+#include "../s21_render_settings.h"
+
+/// @brief Ширина изображения по умолчанию
+#define HEADLESS_W 800
+/// @brief Высота изображения по умолчанию
+#define HEADLESS_H 600
+
+namespace s21 {
+
+/// @brief Задание отрисовки без окна
+struct HeadlessJob_t {
+  /// @brief Путь к модели
+  QString model;
+  /// @brief Трансформации модели в порядке применения
+  std::vector<TransformationStep_t> steps;
+  /// @brief Настройки отрисовки
+  RenderSettingsData settings;
+  /// @brief Размер изображения в пикселях
+  QSize size = QSize(HEADLESS_W, HEADLESS_H);
+};
+
+/// @brief Отрисовка модели в изображение без окна.
+/// Контекст создается на QOffscreenSurface, кадр рисуется тем же Renderer,
+/// что и в окне просмотра, во внеэкранный буфер и читается в память. На
+/// машине без дисплея работает с платформой Qt offscreen и программной
+/// отрисовкой Mesa llvmpipe, без openGL - с SoftwareRenderer.
+class HeadlessRenderer {
+ public:
+  /// @brief Конструктор, создает контекст с форматом по умолчанию
+  HeadlessRenderer();
+  /// @brief Деструктор
+  ~HeadlessRenderer();
+
+  /// @brief Создан ли контекст openGL
+  /// @return true, если отрисовка возможна
+  bool isValid() const;
+  /// @brief Отрисовка задания
+  /// @param job Задание
+  /// @param image Изображение, остается пустым, если модель не загружена
+  /// или контекст не удалось сделать текущим
+  /// @param status Статус загрузки модели
+  /// @return false, если контекст не удалось сделать текущим
+  bool render(const HeadlessJob_t &job, QImage &image, Status_e &status);
+  /// @brief Отрисовка задания без openGL программным растеризатором.
+  /// Рисуется только каркас: ребра и вершины с тестом глубины
+  /// @param job Задание
+  /// @param image Изображение, остается пустым, если модель не загружена
+  /// @return Статус загрузки модели
+  static Status_e renderSoftware(const HeadlessJob_t &job, QImage &image);
+  /// @brief Сравнение с эталонным изображением
+  /// @param image Изображение
+  /// @param golden Эталон
+  /// @param tolerance Допустимая разница каналов
+  /// @return Кол-во пикселей с разницей больше допустимой, -1 при разных
+  /// размерах
+  static qint64 compare(const QImage &image, const QImage &golden,
+                        int tolerance);
+
+ private:
+  /// @brief Внеэкранная поверхность для контекста
+  QOffscreenSurface *surface = nullptr;
+  /// @brief Контекст openGL
+  QOpenGLContext *context = nullptr;
+};
+
+}  // namespace s21
+
+#endif  // S21_HEADLESS_RENDERER_H
\ No newline at end of file
@@ -0,0 +1,20 @@
+#include "s21_image_saver.h"
+
+namespace s21 {
+
+ImageSaver::ImageSaver(QObject *parent) : QObject(parent) {}
+
+ImageSaver::~ImageSaver() { pool.waitForDone(); }
+
+void ImageSaver::save(const QImage &image, const QString &path,
+                      ImageFormat_e format, int quality) {
+  pool.start([this, image, path, format, quality]() {
+    QElapsedTimer timer;
+    timer.start();
+    bool saved = ImageWriter::write(image, path, format, quality);
+    emit imageSaved(path, saved, ImageWriter::name(format),
+                    timer.nsecsElapsed() / 1e6);
+  });
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,53 @@
+/// @mainpage
+/// @file s21_image_saver.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_IMAGE_SAVER_H
+#define S21_IMAGE_SAVER_H
+
+#include "../s21_gui_defines.h"
+#include "s21_image_writer.h"
+
+namespace s21 {
+
+/// @brief Фоновое сохранение изображений.
+/// Кодирование и запись идут в собственном пуле потоков, поэтому поток
+/// интерфейса только копирует кадр и сразу возвращается.
+class ImageSaver : public QObject {
+  Q_OBJECT
+ public:
+  /// @brief Конструктор
+  /// @param parent Родительский объект
+  explicit ImageSaver(QObject *parent = nullptr);
+  /// @brief Деструктор, дожидается записи всех изображений
+  ~ImageSaver();
+  /// @brief Постановка изображения в очередь записи
+  /// @param image Изображение
+  /// @param path Путь к файлу
+  /// @param format Формат файла
+  /// @param quality Качество JPEG от 0 до 100
+  void save(const QImage &image, const QString &path, ImageFormat_e format,
+            int quality = SCREENSHOT_JPEG_QUALITY);
+
+ signals:
+  /// @brief Изображение записано
+  /// @param path Путь к файлу
+  /// @param saved false, если записать не удалось
+  /// @param format Название формата файла
+  /// @param milliseconds Время кодирования и записи, мс
+  void imageSaved(const QString &path, bool saved, const QString &format,
+                  double milliseconds);
+
+ private:
+  /// @brief Пул потоков записи
+  QThreadPool pool;
+};
+
+}  // namespace s21
+
+#endif  // S21_IMAGE_SAVER_H
\ No newline at end of file
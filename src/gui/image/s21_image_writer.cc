@@ -0,0 +1,176 @@
+#include "s21_image_writer.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Буферизованная запись в файл
+class FileBuffer {
+ public:
+  /// @brief Открытие файла
+  /// @param path Путь к файлу
+  explicit FileBuffer(const std::string &path)
+      : file(path, std::ios::binary | std::ios::trunc) {
+    data.reserve(IMAGE_WRITE_BUFFER);
+  }
+  /// @brief Запись байта
+  /// @param value Байт
+  void put(std::uint8_t value) {
+    data.push_back(value);
+    if (data.size() >= IMAGE_WRITE_BUFFER) flush();
+  }
+  /// @brief Запись массива байт
+  /// @param bytes Данные
+  /// @param size Размер
+  void put(const std::uint8_t *bytes, std::size_t size) {
+    if (data.size() + size > IMAGE_WRITE_BUFFER) flush();
+    data.insert(data.end(), bytes, bytes + size);
+  }
+  /// @brief Запись числа в порядке little-endian
+  /// @param value Число
+  /// @param bytes Кол-во байт
+  void putLittle(std::uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+      put(static_cast<std::uint8_t>(value >> 8 * i));
+    }
+  }
+  /// @brief Запись числа в порядке big-endian
+  /// @param value Число
+  void putBig(std::uint32_t value) {
+    for (int i = 3; i >= 0; --i) {
+      put(static_cast<std::uint8_t>(value >> 8 * i));
+    }
+  }
+  /// @brief Сброс буфера на диск
+  void flush() {
+    file.write(reinterpret_cast<const char *>(data.data()), data.size());
+    data.clear();
+  }
+  /// @brief Завершение записи
+  /// @return true, если не было ошибок
+  bool finish() {
+    flush();
+    file.close();
+    return !file.fail();
+  }
+  /// @brief Открыт ли файл
+  /// @return true, если открыт
+  bool isOpened() const { return file.is_open(); }
+
+ private:
+  /// @brief Файл
+  std::ofstream file;
+  /// @brief Буфер
+  std::vector<std::uint8_t> data;
+};
+
+/// @brief Проверка формата, прочитанного из настроек
+/// @param format Формат
+/// @return Формат или PNG, если значение вне перечисления
+ImageFormat_e validFormat(ImageFormat_e format) {
+  return format >= Png_e && format < ImageFormats_e ? format : Png_e;
+}
+
+}  // namespace
+
+bool ImageWriter::write(const QImage &image, const QString &path,
+                        ImageFormat_e format, int quality) {
+  if (image.isNull()) return false;
+  if (format == Jpeg_e) {
+    return image.save(path, "JPG", std::clamp(quality, 0, 100));
+  }
+  QImage rgb = image.format() == QImage::Format_RGB888
+                   ? image
+                   : image.convertToFormat(QImage::Format_RGB888);
+  std::string file = path.toStdString();
+  const std::uint8_t *pixels = rgb.constBits();
+  int stride = static_cast<int>(rgb.bytesPerLine());
+  switch (validFormat(format)) {
+    case Qoi_e:
+      return writeQoi(file, pixels, rgb.width(), rgb.height(), stride);
+    case Bmp_e:
+      return writeBmp(file, pixels, rgb.width(), rgb.height(), stride);
+    case Ppm_e:
+      return writePpm(file, pixels, rgb.width(), rgb.height(), stride);
+    default:
+      return PngWriter::save(file, pixels, rgb.width(), rgb.height(), stride);
+  }
+}
+
+const char *ImageWriter::extension(ImageFormat_e format) {
+  static const char *const extensions[ImageFormats_e] = {".png", ".qoi",
+                                                         ".bmp", ".ppm",
+                                                         ".jpg"};
+  return extensions[validFormat(format)];
+}
+
+const char *ImageWriter::name(ImageFormat_e format) {
+  static const char *const names[ImageFormats_e] = {"PNG", "QOI", "BMP",
+                                                    "PPM", "JPEG"};
+  return names[validFormat(format)];
+}
+
+bool ImageWriter::writeQoi(const std::string &path, const std::uint8_t *pixels,
+                           int width, int height, int stride) {
+  FileBuffer out(path);
+  if (!out.isOpened()) return false;
+  std::vector<std::uint8_t> data;
+  QoiCodec::encode(pixels, width, height, stride, data);
+  out.put(data.data(), data.size());
+  return out.finish();
+}
+
+bool ImageWriter::writeBmp(const std::string &path, const std::uint8_t *pixels,
+                           int width, int height, int stride) {
+  FileBuffer out(path);
+  if (!out.isOpened()) return false;
+  std::size_t rowBytes = static_cast<std::size_t>(width) * 3;
+  std::size_t padded = (rowBytes + 3) & ~static_cast<std::size_t>(3);
+  std::uint32_t imageBytes = static_cast<std::uint32_t>(padded * height);
+  out.put('B');
+  out.put('M');
+  out.putLittle(54 + imageBytes, 4);
+  out.putLittle(0, 4);
+  out.putLittle(54, 4);
+  out.putLittle(40, 4);
+  out.putLittle(static_cast<std::uint32_t>(width), 4);
+  out.putLittle(static_cast<std::uint32_t>(height), 4);
+  out.putLittle(1, 2);
+  out.putLittle(24, 2);
+  out.putLittle(0, 4);
+  out.putLittle(imageBytes, 4);
+  out.putLittle(2835, 4);
+  out.putLittle(2835, 4);
+  out.putLittle(0, 4);
+  out.putLittle(0, 4);
+
+  std::vector<std::uint8_t> row(padded, 0);
+  for (int y = height - 1; y >= 0; --y) {
+    const std::uint8_t *source =
+        pixels + static_cast<std::ptrdiff_t>(y) * stride;
+    for (std::size_t i = 0; i < rowBytes; i += 3) {
+      row[i] = source[i + 2];
+      row[i + 1] = source[i + 1];
+      row[i + 2] = source[i];
+    }
+    out.put(row.data(), row.size());
+  }
+  return out.finish();
+}
+
+bool ImageWriter::writePpm(const std::string &path, const std::uint8_t *pixels,
+                           int width, int height, int stride) {
+  FileBuffer out(path);
+  if (!out.isOpened()) return false;
+  std::string header = "P6\n" + std::to_string(width) + " " +
+                       std::to_string(height) + "\n255\n";
+  out.put(reinterpret_cast<const std::uint8_t *>(header.data()),
+          header.size());
+  std::size_t rowBytes = static_cast<std::size_t>(width) * 3;
+  for (int y = 0; y < height; ++y) {
+    out.put(pixels + static_cast<std::ptrdiff_t>(y) * stride, rowBytes);
+  }
+  return out.finish();
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,83 @@
+/// @mainpage
+/// @file s21_image_writer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_IMAGE_WRITER_H
+#define S21_IMAGE_WRITER_H
+
+#include "../../backend/image/s21_qoi.h"
+#include "../s21_gui_defines.h"
+#include "s21_png_writer.h"
+
+/// @brief Качество JPEG скриншотов по умолчанию
+#define SCREENSHOT_JPEG_QUALITY 90
+/// @brief Размер буфера записи файла в байтах
+#define IMAGE_WRITE_BUFFER (1 << 20)
+
+namespace s21 {
+
+/// @brief Форматы сохранения скриншотов
+enum ImageFormat_e { Png_e, Qoi_e, Bmp_e, Ppm_e, Jpeg_e, ImageFormats_e };
+
+/// @brief Запись изображения в файл в выбранном формате.
+/// PNG сжимается параллельно, QOI кодируется за один проход без сжатия
+/// энтропийным кодером, BMP и PPM пишутся без сжатия, JPEG кодирует Qt с
+/// заданным качеством. Все форматы, кроме JPEG, пишут RGB по строкам.
+class ImageWriter {
+ public:
+  /// @brief Запись изображения
+  /// @param image Изображение в любом формате QImage
+  /// @param path Путь к файлу
+  /// @param format Формат файла
+  /// @param quality Качество JPEG от 0 до 100
+  /// @return false, если файл не записан
+  static bool write(const QImage &image, const QString &path,
+                    ImageFormat_e format,
+                    int quality = SCREENSHOT_JPEG_QUALITY);
+  /// @brief Расширение файла для формата
+  /// @param format Формат файла
+  /// @return Расширение с точкой
+  static const char *extension(ImageFormat_e format);
+  /// @brief Название формата для журнала и интерфейса
+  /// @param format Формат файла
+  /// @return Название
+  static const char *name(ImageFormat_e format);
+
+ private:
+  /// @brief Запись QOI, кодирует QoiCodec
+  /// @param path Путь к файлу
+  /// @param pixels Пиксели RGB сверху вниз
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param stride Байт в строке
+  /// @return false, если файл не записан
+  static bool writeQoi(const std::string &path, const std::uint8_t *pixels,
+                       int width, int height, int stride);
+  /// @brief Запись 24-битного BMP, строки снизу вверх с выравниванием
+  /// @param path Путь к файлу
+  /// @param pixels Пиксели RGB сверху вниз
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param stride Байт в строке
+  /// @return false, если файл не записан
+  static bool writeBmp(const std::string &path, const std::uint8_t *pixels,
+                       int width, int height, int stride);
+  /// @brief Запись двоичного PPM (P6)
+  /// @param path Путь к файлу
+  /// @param pixels Пиксели RGB сверху вниз
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param stride Байт в строке
+  /// @return false, если файл не записан
+  static bool writePpm(const std::string &path, const std::uint8_t *pixels,
+                       int width, int height, int stride);
+};
+
+}  // namespace s21
+
+#endif  // S21_IMAGE_WRITER_H
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "s21_png_writer.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Запись 32-битного числа в порядке big-endian
+/// @param out Куда писать
+/// @param value Число
+void put32(std::uint8_t *out, std::uint32_t value) {
+  out[0] = static_cast<std::uint8_t>(value >> 24);
+  out[1] = static_cast<std::uint8_t>(value >> 16);
+  out[2] = static_cast<std::uint8_t>(value >> 8);
+  out[3] = static_cast<std::uint8_t>(value);
+}
+
+}  // namespace
+
+PngWriter::~PngWriter() { close(); }
+
+bool PngWriter::save(const std::string &path, const std::uint8_t *pixels,
+                     int width, int height, int stride, int level) {
+  PngWriter png;
+  if (!png.writeHeader(path, width, height)) return false;
+  std::size_t rowBytes = static_cast<std::size_t>(width) * 3;
+  std::size_t rows = static_cast<std::size_t>(height);
+  std::size_t chunks = parallelWorkers(rows * rowBytes, PNG_PARALLEL_GRAIN);
+  std::vector<std::vector<std::uint8_t>> parts(chunks);
+  std::vector<uLong> sums(chunks);
+  std::vector<char> failed(chunks, 0);
+  parallelForChunks(rows, chunks, [&](std::size_t chunk, std::size_t begin,
+                                      std::size_t end) {
+    z_stream part{};
+    if (deflateInit2(&part, level, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+      failed[chunk] = 1;
+      return;
+    }
+    std::vector<std::uint8_t> &out = parts[chunk];
+    out.resize(deflateBound(&part, (end - begin) * (rowBytes + 1)) + 16);
+    part.next_out = out.data();
+    part.avail_out = static_cast<uInt>(out.size());
+    std::vector<std::uint8_t> filtered(rowBytes + 1);
+    uLong sum = adler32(0, nullptr, 0);
+    for (std::size_t y = begin; y < end; ++y) {
+      const std::uint8_t *row = pixels + y * stride;
+      const std::uint8_t *up = y ? row - stride : nullptr;
+      filtered[0] = 2;
+      for (std::size_t i = 0; i < rowBytes; ++i) {
+        std::uint8_t above = up ? up[i] : 0;
+        filtered[i + 1] = static_cast<std::uint8_t>(row[i] - above);
+      }
+      sum = adler32(sum, filtered.data(), static_cast<uInt>(filtered.size()));
+      part.next_in = filtered.data();
+      part.avail_in = static_cast<uInt>(filtered.size());
+      deflate(&part, Z_NO_FLUSH);
+    }
+    int result =
+        deflate(&part, chunk + 1 == chunks ? Z_FINISH : Z_SYNC_FLUSH);
+    failed[chunk] = result == Z_STREAM_ERROR || result == Z_BUF_ERROR;
+    out.resize(out.size() - part.avail_out);
+    sums[chunk] = sum;
+    deflateEnd(&part);
+  });
+
+  uLong sum = adler32(0, nullptr, 0);
+  const std::uint8_t header[2] = {0x78, 0x9C};
+  png.writeChunk("IDAT", header, 2);
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+    std::size_t begin = rows * chunk / chunks;
+    std::size_t end = rows * (chunk + 1) / chunks;
+    sum = adler32_combine(sum, sums[chunk],
+                          static_cast<z_off_t>((end - begin) * (rowBytes + 1)));
+    png.writeChunk("IDAT", parts[chunk].data(), parts[chunk].size());
+  }
+  std::uint8_t trailer[4];
+  put32(trailer, static_cast<std::uint32_t>(sum));
+  png.writeChunk("IDAT", trailer, 4);
+  bool complete = std::find(failed.begin(), failed.end(), 1) == failed.end();
+  return png.writeEnd() && complete;
+}
+
+bool PngWriter::open(const std::string &path, int width, int height,
+                     int level) {
+  close();
+  if (!writeHeader(path, width, height)) return false;
+  stream = z_stream{};
+  if (deflateInit(&stream, level) != Z_OK) {
+    file.close();
+    return false;
+  }
+  imageWidth = width;
+  rowsLeft = height;
+  std::size_t rowBytes = static_cast<std::size_t>(width) * 3;
+  previous.assign(rowBytes, 0);
+  filtered.assign(rowBytes + 1, 0);
+  chunk.resize(PNG_CHUNK_BYTES);
+  stream.next_out = chunk.data();
+  stream.avail_out = PNG_CHUNK_BYTES;
+  return file.good();
+}
+
+bool PngWriter::writeHeader(const std::string &path, int width, int height) {
+  file.open(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return false;
+  const std::uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A,
+                                     '\n'};
+  file.write(reinterpret_cast<const char *>(signature), 8);
+  std::uint8_t header[13] = {};
+  put32(header, static_cast<std::uint32_t>(width));
+  put32(header + 4, static_cast<std::uint32_t>(height));
+  header[8] = 8;
+  header[9] = 2;
+  writeChunk("IHDR", header, sizeof(header));
+  return file.good();
+}
+
+bool PngWriter::writeEnd() {
+  writeChunk("IEND", nullptr, 0);
+  bool good = file.good();
+  file.close();
+  return good;
+}
+
+bool PngWriter::isOpened() const { return file.is_open(); }
+
+void PngWriter::writeRow(const std::uint8_t *rgb) {
+  if (!file.is_open() || rowsLeft <= 0) return;
+  std::size_t rowBytes = previous.size();
+  filtered[0] = 2;
+  for (std::size_t i = 0; i < rowBytes; ++i) {
+    filtered[i + 1] = static_cast<std::uint8_t>(rgb[i] - previous[i]);
+  }
+  std::memcpy(previous.data(), rgb, rowBytes);
+  deflateData(filtered.data(), filtered.size(), Z_NO_FLUSH);
+  --rowsLeft;
+}
+
+bool PngWriter::close() {
+  if (!file.is_open()) return false;
+  deflateData(nullptr, 0, Z_FINISH);
+  if (stream.avail_out < PNG_CHUNK_BYTES) {
+    writeChunk("IDAT", chunk.data(), PNG_CHUNK_BYTES - stream.avail_out);
+  }
+  deflateEnd(&stream);
+  bool complete = rowsLeft == 0;
+  previous.clear();
+  filtered.clear();
+  chunk.clear();
+  return writeEnd() && complete;
+}
+
+void PngWriter::deflateData(const std::uint8_t *data, std::size_t size,
+                            int flush) {
+  stream.next_in = const_cast<Bytef *>(data);
+  stream.avail_in = static_cast<uInt>(size);
+  int result = Z_OK;
+  do {
+    if (stream.avail_out == 0) {
+      writeChunk("IDAT", chunk.data(), PNG_CHUNK_BYTES);
+      stream.next_out = chunk.data();
+      stream.avail_out = PNG_CHUNK_BYTES;
+    }
+    result = deflate(&stream, flush);
+  } while (result == Z_OK &&
+           (stream.avail_in > 0 || stream.avail_out == 0 ||
+            flush == Z_FINISH));
+}
+
+void PngWriter::writeChunk(const char *type, const std::uint8_t *data,
+                           std::size_t size) {
+  std::uint8_t length[4];
+  put32(length, static_cast<std::uint32_t>(size));
+  file.write(reinterpret_cast<const char *>(length), 4);
+  file.write(type, 4);
+  uLong crc = crc32(0, reinterpret_cast<const Bytef *>(type), 4);
+  if (size) {
+    file.write(reinterpret_cast<const char *>(data), size);
+    crc = crc32(crc, data, static_cast<uInt>(size));
+  }
+  std::uint8_t sum[4];
+  put32(sum, static_cast<std::uint32_t>(crc));
+  file.write(reinterpret_cast<const char *>(sum), 4);
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,106 @@
+/// @mainpage
+/// @file s21_png_writer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_PNG_WRITER_H
+#define S21_PNG_WRITER_H
+
+#include <zlib.h>
+
+#include "../../common/s21_parallel.h"
+
+/// @brief Размер блока IDAT в байтах
+#define PNG_CHUNK_BYTES (1 << 16)
+/// @brief Минимум байт изображения на поток параллельного сжатия
+#define PNG_PARALLEL_GRAIN (1 << 20)
+
+namespace s21 {
+
+/// @brief Потоковая запись PNG (RGB, 8 бит на канал).
+/// Строки передаются сверху вниз и сразу сжимаются, в памяти хранится
+/// только прошлая строка для фильтра Up и неполный блок IDAT, поэтому размер
+/// изображения не ограничен памятью. Изображение, уже лежащее в памяти,
+/// save() сжимает параллельно полосами строк.
+class PngWriter {
+ public:
+  /// @brief Параллельная запись изображения из памяти. Каждая полоса строк
+  /// сжимается отдельным потоком deflate, завершенным Z_SYNC_FLUSH, потоки
+  /// склеиваются в один, а контрольная сумма собирается adler32_combine
+  /// @param path Путь к файлу
+  /// @param pixels Пиксели RGB сверху вниз
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param stride Байт в строке
+  /// @param level Уровень сжатия zlib
+  /// @return false, если файл не записан
+  static bool save(const std::string &path, const std::uint8_t *pixels,
+                   int width, int height, int stride,
+                   int level = Z_DEFAULT_COMPRESSION);
+
+  /// @brief Деструктор, закрывает файл
+  ~PngWriter();
+
+  /// @brief Открытие файла и запись заголовка
+  /// @param path Путь к файлу
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param level Уровень сжатия zlib
+  /// @return false, если файл не открылся
+  bool open(const std::string &path, int width, int height,
+            int level = Z_DEFAULT_COMPRESSION);
+  /// @brief Открыт ли файл
+  /// @return true, если открыт
+  bool isOpened() const;
+  /// @brief Запись очередной строки
+  /// @param rgb Пиксели строки RGB, 3 байта на пиксель
+  void writeRow(const std::uint8_t *rgb);
+  /// @brief Завершение сжатия, запись IEND и закрытие файла
+  /// @return true, если записаны все строки и не было ошибок
+  bool close();
+
+ private:
+  /// @brief Открытие файла, запись сигнатуры и IHDR
+  /// @param path Путь к файлу
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @return false, если файл не открылся
+  bool writeHeader(const std::string &path, int width, int height);
+  /// @brief Запись IEND и закрытие файла
+  /// @return true, если не было ошибок записи
+  bool writeEnd();
+  /// @brief Сжатие данных с записью заполненных блоков IDAT
+  /// @param data Данные
+  /// @param size Размер данных
+  /// @param flush Режим сброса zlib
+  void deflateData(const std::uint8_t *data, std::size_t size, int flush);
+  /// @brief Запись блока PNG
+  /// @param type Тип блока
+  /// @param data Данные
+  /// @param size Размер данных
+  void writeChunk(const char *type, const std::uint8_t *data,
+                  std::size_t size);
+
+  /// @brief Файл
+  std::ofstream file;
+  /// @brief Поток сжатия
+  z_stream stream{};
+  /// @brief Ширина изображения
+  int imageWidth = 0;
+  /// @brief Строк осталось записать
+  int rowsLeft = 0;
+  /// @brief Прошлая строка
+  std::vector<std::uint8_t> previous;
+  /// @brief Отфильтрованная строка с байтом фильтра
+  std::vector<std::uint8_t> filtered;
+  /// @brief Выход сжатия, блок IDAT
+  std::vector<std::uint8_t> chunk;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
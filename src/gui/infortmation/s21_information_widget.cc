@@ -12,8 +12,28 @@ InformationWidget::~InformationWidget() {
   if (fileName) fileName->deleteLater();
   if (verticesText) verticesText->deleteLater();
   if (verticesCount) verticesCount->deleteLater();
+  if (displayedText) displayedText->deleteLater();
+  if (displayedCount) displayedCount->deleteLater();
   if (edgesText) edgesText->deleteLater();
   if (edgesCount) edgesCount->deleteLater();
+  if (frameTimeText) frameTimeText->deleteLater();
+  if (frameTime) frameTime->deleteLater();
+  if (latencyText) latencyText->deleteLater();
+  if (latency) latency->deleteLater();
+  if (fpsText) fpsText->deleteLater();
+  if (fps) fps->deleteLater();
+  if (fragmentsText) fragmentsText->deleteLater();
+  if (fragments) fragments->deleteLater();
+  if (detailText) detailText->deleteLater();
+  if (detail) detail->deleteLater();
+  if (resolutionText) resolutionText->deleteLater();
+  if (resolution) resolution->deleteLater();
+  if (residentText) residentText->deleteLater();
+  if (resident) resident->deleteLater();
+  if (saveTimeText) saveTimeText->deleteLater();
+  if (saveTime) saveTime->deleteLater();
+  if (encodeRateText) encodeRateText->deleteLater();
+  if (encodeRate) encodeRate->deleteLater();
 }
 
 void InformationWidget::initLabels() {
@@ -21,8 +41,28 @@ void InformationWidget::initLabels() {
   fileName = createLabel("");
   verticesText = createLabel("Verices count:");
   verticesCount = createLabel("0");
+  displayedText = createLabel("Displayed points:");
+  displayedCount = createLabel("0");
   edgesText = createLabel("Edges count:");
   edgesCount = createLabel("0");
+  frameTimeText = createLabel("Frame CPU time:");
+  frameTime = createLabel("-");
+  latencyText = createLabel("Input latency:");
+  latency = createLabel("-");
+  fpsText = createLabel("Drag FPS:");
+  fps = createLabel("-");
+  fragmentsText = createLabel("Edge fragments:");
+  fragments = createLabel("-");
+  detailText = createLabel("Detail:");
+  detail = createLabel("100%");
+  resolutionText = createLabel("Resolution:");
+  resolution = createLabel("100%");
+  residentText = createLabel("Resident memory:");
+  resident = createLabel("-");
+  saveTimeText = createLabel("Screenshot save:");
+  saveTime = createLabel("-");
+  encodeRateText = createLabel("Video encode:");
+  encodeRate = createLabel("-");
 }
 
 QLabel *InformationWidget::createLabel(const QString &text) {
@@ -37,7 +77,17 @@ void InformationWidget::initLayout() {
   QVBoxLayout *layout = new QVBoxLayout(this);
   QHBoxLayout *layoutName = new QHBoxLayout;
   QHBoxLayout *layoutVertices = new QHBoxLayout;
+  QHBoxLayout *layoutDisplayed = new QHBoxLayout;
   QHBoxLayout *layoutEdges = new QHBoxLayout;
+  QHBoxLayout *layoutFrameTime = new QHBoxLayout;
+  QHBoxLayout *layoutLatency = new QHBoxLayout;
+  QHBoxLayout *layoutFps = new QHBoxLayout;
+  QHBoxLayout *layoutFragments = new QHBoxLayout;
+  QHBoxLayout *layoutDetail = new QHBoxLayout;
+  QHBoxLayout *layoutResolution = new QHBoxLayout;
+  QHBoxLayout *layoutResident = new QHBoxLayout;
+  QHBoxLayout *layoutSaveTime = new QHBoxLayout;
+  QHBoxLayout *layoutEncodeRate = new QHBoxLayout;
 
   layoutName->addWidget(fileNameText, 1, Qt::AlignLeft | Qt::AlignVCenter);
   layoutName->addWidget(fileName, 1, Qt::AlignRight | Qt::AlignVCenter);
@@ -46,20 +96,105 @@ void InformationWidget::initLayout() {
   layoutVertices->addWidget(verticesCount, 1,
                             Qt::AlignRight | Qt::AlignVCenter);
 
+  layoutDisplayed->addWidget(displayedText, 1,
+                             Qt::AlignLeft | Qt::AlignVCenter);
+  layoutDisplayed->addWidget(displayedCount, 1,
+                             Qt::AlignRight | Qt::AlignVCenter);
+
   layoutEdges->addWidget(edgesText, 1, Qt::AlignLeft | Qt::AlignVCenter);
   layoutEdges->addWidget(edgesCount, 1, Qt::AlignRight | Qt::AlignVCenter);
 
+  layoutFrameTime->addWidget(frameTimeText, 1,
+                             Qt::AlignLeft | Qt::AlignVCenter);
+  layoutFrameTime->addWidget(frameTime, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutLatency->addWidget(latencyText, 1, Qt::AlignLeft | Qt::AlignVCenter);
+  layoutLatency->addWidget(latency, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutFps->addWidget(fpsText, 1, Qt::AlignLeft | Qt::AlignVCenter);
+  layoutFps->addWidget(fps, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutFragments->addWidget(fragmentsText, 1,
+                             Qt::AlignLeft | Qt::AlignVCenter);
+  layoutFragments->addWidget(fragments, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutDetail->addWidget(detailText, 1, Qt::AlignLeft | Qt::AlignVCenter);
+  layoutDetail->addWidget(detail, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutResolution->addWidget(resolutionText, 1,
+                              Qt::AlignLeft | Qt::AlignVCenter);
+  layoutResolution->addWidget(resolution, 1,
+                              Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutResident->addWidget(residentText, 1, Qt::AlignLeft | Qt::AlignVCenter);
+  layoutResident->addWidget(resident, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutSaveTime->addWidget(saveTimeText, 1, Qt::AlignLeft | Qt::AlignVCenter);
+  layoutSaveTime->addWidget(saveTime, 1, Qt::AlignRight | Qt::AlignVCenter);
+
+  layoutEncodeRate->addWidget(encodeRateText, 1,
+                              Qt::AlignLeft | Qt::AlignVCenter);
+  layoutEncodeRate->addWidget(encodeRate, 1,
+                              Qt::AlignRight | Qt::AlignVCenter);
+
   layout->addLayout(layoutName);
   layout->addLayout(layoutVertices);
+  layout->addLayout(layoutDisplayed);
   layout->addLayout(layoutEdges);
+  layout->addLayout(layoutFrameTime);
+  layout->addLayout(layoutLatency);
+  layout->addLayout(layoutFps);
+  layout->addLayout(layoutFragments);
+  layout->addLayout(layoutDetail);
+  layout->addLayout(layoutResolution);
+  layout->addLayout(layoutResident);
+  layout->addLayout(layoutSaveTime);
+  layout->addLayout(layoutEncodeRate);
 }
 
 void InformationWidget::updateInformation(QString file, std::size_t vertices,
+                                          std::size_t displayed,
                                           std::size_t edges) {
   fileName->setText(QFileInfo(file).fileName());
   verticesCount->setText(QString::number(static_cast<qulonglong>(vertices)));
+  displayedCount->setText(
+      QString::number(static_cast<qulonglong>(displayed)));
   edgesCount->setText(QString::number(static_cast<qulonglong>(edges)));
   update();
 }
 
+void InformationWidget::updateFrameStatistics(
+    const FrameStatistics &statistics) {
+  frameTime->setText(QString::number(statistics.cpuTime, 'f', 2) + " ms");
+  if (statistics.latency > 0) {
+    latency->setText(QString::number(statistics.latency, 'f', 2) + " ms");
+  }
+  if (statistics.fps > 0) {
+    fps->setText(QString::number(statistics.fps, 'f', 1));
+  }
+  fragments->setText(
+      QString::number(static_cast<qulonglong>(statistics.edgeFragments)));
+  detail->setText(QString::number(statistics.detail * 100, 'f', 0) + "%");
+  resolution->setText(
+      QString::number(statistics.resolutionScale * 100, 'f', 0) + "%");
+  if (statistics.residentAfter > 0) {
+    resident->setText(
+        QString("%1 -> %2 MB")
+            .arg(statistics.residentBefore / 1048576.0, 0, 'f', 0)
+            .arg(statistics.residentAfter / 1048576.0, 0, 'f', 0));
+  }
+}
+
+void InformationWidget::updateSaveTime(const QString &format,
+                                       double milliseconds) {
+  saveTime->setText(format + " " + QString::number(milliseconds, 'f', 1) +
+                    " ms");
+}
+
+void InformationWidget::updateEncodeRate(int frames, double framesPerSecond) {
+  encodeRate->setText(QString("%1 frames, %2 fps")
+                          .arg(frames)
+                          .arg(framesPerSecond, 0, 'f', 1));
+}
+
 }  // namespace s21
\ No newline at end of file
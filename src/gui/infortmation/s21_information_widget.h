@@ -10,6 +10,7 @@
 #ifndef S21_INFORMATION_WIDGET_H
 #define S21_INFORMATION_WIDGET_H
 
+#include "../OpenGL/s21_renderer.h"
 #include "../s21_gui_defines.h"
 
 namespace s21 {
@@ -27,8 +28,21 @@ class InformationWidget : public QWidget {
   /// @brief обновление информации о детале
   /// @param file имя файла
   /// @param vertices кол-во вершин
+  /// @param displayed кол-во отображаемых вершин
   /// @param edges кол-во ребер
-  void updateInformation(QString file, std::size_t vertices, std::size_t edges);
+  void updateInformation(QString file, std::size_t vertices,
+                         std::size_t displayed, std::size_t edges);
+  /// @brief обновление статистики кадра
+  /// @param statistics статистика последнего кадра
+  void updateFrameStatistics(const FrameStatistics &statistics);
+  /// @brief обновление времени записи скриншота
+  /// @param format название формата файла
+  /// @param milliseconds время кодирования и записи, мс
+  void updateSaveTime(const QString &format, double milliseconds);
+  /// @brief обновление скорости кодирования видео
+  /// @param frames кол-во закодированных кадров
+  /// @param framesPerSecond кадров в секунду
+  void updateEncodeRate(int frames, double framesPerSecond);
 
  private:
   /// @brief Инициализация текста
@@ -48,10 +62,50 @@ class InformationWidget : public QWidget {
   QLabel *verticesText = nullptr;
   /// @brief кол-во вершин
   QLabel *verticesCount = nullptr;
+  /// @brief текст: кол-во отображаемых вершин
+  QLabel *displayedText = nullptr;
+  /// @brief кол-во отображаемых вершин
+  QLabel *displayedCount = nullptr;
   /// @brief текст кол-во ребер
   QLabel *edgesText = nullptr;
   /// @brief кол-во ребер
   QLabel *edgesCount = nullptr;
+  /// @brief текст: время кадра
+  QLabel *frameTimeText = nullptr;
+  /// @brief время кадра
+  QLabel *frameTime = nullptr;
+  /// @brief текст: задержка ввода
+  QLabel *latencyText = nullptr;
+  /// @brief задержка ввода
+  QLabel *latency = nullptr;
+  /// @brief текст: кадров в секунду
+  QLabel *fpsText = nullptr;
+  /// @brief кадров в секунду
+  QLabel *fps = nullptr;
+  /// @brief текст: фрагменты ребер
+  QLabel *fragmentsText = nullptr;
+  /// @brief фрагменты ребер, прошедшие тест глубины
+  QLabel *fragments = nullptr;
+  /// @brief текст: доля деталей
+  QLabel *detailText = nullptr;
+  /// @brief доля ребер и вершин, рисуемых при взаимодействии
+  QLabel *detail = nullptr;
+  /// @brief текст: масштаб разрешения
+  QLabel *resolutionText = nullptr;
+  /// @brief масштаб разрешения кадра
+  QLabel *resolution = nullptr;
+  /// @brief текст: резидентная память
+  QLabel *residentText = nullptr;
+  /// @brief резидентная память до и после освобождения геометрии
+  QLabel *resident = nullptr;
+  /// @brief текст: запись скриншота
+  QLabel *saveTimeText = nullptr;
+  /// @brief формат и время записи последнего скриншота
+  QLabel *saveTime = nullptr;
+  /// @brief текст: кодирование видео
+  QLabel *encodeRateText = nullptr;
+  /// @brief скорость кодирования последнего видео
+  QLabel *encodeRate = nullptr;
 };
 }  // namespace s21
 
@@ -2,7 +2,7 @@
 
 namespace s21 {
 
-MenuWidget::MenuWidget(QWidget *parent, QSettings *set)
+MenuWidget::MenuWidget(QWidget *parent, RenderSettings *set)
     : QWidget{parent}, settings(set) {
   setFixedWidth(MENU_WINDOW_W);
   createButtons();
@@ -14,29 +14,58 @@ MenuWidget::MenuWidget(QWidget *parent, QSettings *set)
 MenuWidget::~MenuWidget() {
   if (buttonOpenModel) buttonOpenModel->deleteLater();
   if (buttonToggleProjection) buttonToggleProjection->deleteLater();
+  if (buttonDisplayMode) buttonDisplayMode->deleteLater();
+  if (buttonDynamicResolution) buttonDynamicResolution->deleteLater();
+  if (buttonGpuResident) buttonGpuResident->deleteLater();
   if (pathLine) pathLine->deleteLater();
+  if (buttonScreenshotFormat) buttonScreenshotFormat->deleteLater();
   if (buttonScreenshot) buttonScreenshot->deleteLater();
+  if (buttonLargeScreenshot) buttonLargeScreenshot->deleteLater();
   if (buttonReset) buttonReset->deleteLater();
   if (buttonCaptureVideo) buttonCaptureVideo->deleteLater();
+  if (buttonCaptureGif) buttonCaptureGif->deleteLater();
+  if (buttonTurntable) buttonTurntable->deleteLater();
 }
 
 void MenuWidget::createButtons() {
   buttonOpenModel = createButton("Open Model");
   buttonReset = createButton("Reset Model");
   buttonToggleProjection = createButton("Toggle Projection");
+  buttonDisplayMode = createButton("Display Mode");
+  buttonDynamicResolution = createButton("Dynamic Resolution");
+  buttonGpuResident = createButton("GPU Resident");
+  buttonScreenshotFormat = createButton("");
+  updateScreenshotFormat();
   buttonScreenshot = createButton("Screenshot");
+  buttonLargeScreenshot = createButton("Hi-Res Screenshot");
   buttonCaptureVideo = createButton("Capture Video");
+  buttonCaptureGif = createButton("Capture GIF");
+  buttonTurntable = createButton("Render Turntable");
 
   connect(buttonOpenModel, &QPushButton::clicked, this,
           &MenuWidget::openPressed);
+  connect(buttonScreenshotFormat, &QPushButton::clicked, this,
+          &MenuWidget::toggleScreenshotFormatPressed);
   connect(buttonScreenshot, &QPushButton::clicked, this,
           &MenuWidget::screenshotPressed);
+  connect(buttonLargeScreenshot, &QPushButton::clicked, this,
+          &MenuWidget::largeScreenshotPressed);
   connect(buttonReset, &QPushButton::clicked, this,
           &MenuWidget::resetTransformationPressed);
   connect(buttonToggleProjection, &QPushButton::clicked, this,
           &MenuWidget::toggleProjectionPressed);
+  connect(buttonDisplayMode, &QPushButton::clicked, this,
+          &MenuWidget::toggleDisplayModePressed);
+  connect(buttonDynamicResolution, &QPushButton::clicked, this,
+          &MenuWidget::toggleDynamicResolutionPressed);
+  connect(buttonGpuResident, &QPushButton::clicked, this,
+          &MenuWidget::toggleGpuResidentPressed);
   connect(buttonCaptureVideo, &QPushButton::clicked, this,
           &MenuWidget::captureVideoPressed);
+  connect(buttonCaptureGif, &QPushButton::clicked, this,
+          &MenuWidget::captureGifPressed);
+  connect(buttonTurntable, &QPushButton::clicked, this,
+          &MenuWidget::renderTurntablePressed);
 }
 
 QPushButton *MenuWidget::createButton(const QString &text) {
@@ -59,8 +88,15 @@ void MenuWidget::createLayout() {
   layout->addWidget(pathLine);
   layout->addWidget(buttonReset);
   layout->addWidget(buttonToggleProjection);
+  layout->addWidget(buttonDisplayMode);
+  layout->addWidget(buttonDynamicResolution);
+  layout->addWidget(buttonGpuResident);
+  layout->addWidget(buttonScreenshotFormat);
   layout->addWidget(buttonScreenshot);
+  layout->addWidget(buttonLargeScreenshot);
   layout->addWidget(buttonCaptureVideo);
+  layout->addWidget(buttonCaptureGif);
+  layout->addWidget(buttonTurntable);
   layout->setSpacing(SPACING);
   layout->setAlignment(Qt::AlignHCenter | Qt::AlignVCenter);
 }
@@ -72,12 +108,16 @@ void MenuWidget::initSignals() {
             &MainWindow::openModel);
     connect(this, &MenuWidget::resetTransformationPressed, mainWindow,
             &MainWindow::resetTransformation);
-    connect(this, &MenuWidget::settingsChanged, mainWindow,
-            &MainWindow::updateFromSettings);
     connect(this, &MenuWidget::screenshotSignal, mainWindow,
             &MainWindow::captureScreenshot);
+    connect(this, &MenuWidget::largeScreenshotSignal, mainWindow,
+            &MainWindow::captureLargeScreenshot);
     connect(this, &MenuWidget::captureVideoSignal, mainWindow,
             &MainWindow::captureVideo);
+    connect(this, &MenuWidget::captureGifSignal, mainWindow,
+            &MainWindow::captureGif);
+    connect(this, &MenuWidget::renderTurntableSignal, mainWindow,
+            &MainWindow::renderTurntable);
   }
 }
 
@@ -88,6 +128,13 @@ void MenuWidget::screenshotPressed() {
   emit screenshotSignal(directory);
 }
 
+void MenuWidget::largeScreenshotPressed() {
+  QString directory = QFileDialog::getExistingDirectory(
+      this, "Выберите директорию для сохранения", QDir::currentPath(),
+      QFileDialog::ShowDirsOnly | QFileDialog::DontResolveSymlinks);
+  emit largeScreenshotSignal(directory);
+}
+
 void MenuWidget::captureVideoPressed() {
   QString directory = QFileDialog::getExistingDirectory(
       this, "Выберите директорию для сохранения", QDir::currentPath(),
@@ -95,6 +142,20 @@ void MenuWidget::captureVideoPressed() {
   emit captureVideoSignal(directory);
 }
 
+void MenuWidget::captureGifPressed() {
+  QString directory = QFileDialog::getExistingDirectory(
+      this, "Выберите директорию для сохранения", QDir::currentPath(),
+      QFileDialog::ShowDirsOnly | QFileDialog::DontResolveSymlinks);
+  emit captureGifSignal(directory);
+}
+
+void MenuWidget::renderTurntablePressed() {
+  QStringList files = QFileDialog::getOpenFileNames(
+      this, "Выберите модели", QDir::currentPath(),
+      "OBJ Files (*.obj);;All Files (*)");
+  emit renderTurntableSignal(files);
+}
+
 void MenuWidget::openPressed() {
   QString pathToFile = pathLine->text();
   pathLine->clear();
@@ -107,8 +168,37 @@ void MenuWidget::openPressed() {
 }
 
 void MenuWidget::toggleProjectionPressed() {
-  settings->setValue("isOrtho", !(settings->value("isOrtho").toBool()));
-  emit settingsChanged();
+  settings->setOrtho(!settings->data().isOrtho);
+}
+
+void MenuWidget::toggleDisplayModePressed() {
+  settings->setValue(
+      &RenderSettingsData::displayMode,
+      (settings->data().displayMode + 1) % DisplayMode_e::DisplayModes_e);
+}
+
+void MenuWidget::toggleDynamicResolutionPressed() {
+  settings->setValue(&RenderSettingsData::dynamicResolution,
+                     !settings->data().dynamicResolution);
+}
+
+void MenuWidget::toggleGpuResidentPressed() {
+  settings->setValue(&RenderSettingsData::gpuResident,
+                     !settings->data().gpuResident);
+}
+
+void MenuWidget::toggleScreenshotFormatPressed() {
+  settings->setValue(
+      &RenderSettingsData::screenshotFormat,
+      (settings->data().screenshotFormat + 1) % ImageFormat_e::ImageFormats_e);
+  updateScreenshotFormat();
+}
+
+void MenuWidget::updateScreenshotFormat() {
+  ImageFormat_e format =
+      static_cast<ImageFormat_e>(settings->data().screenshotFormat);
+  buttonScreenshotFormat->setText(QString("Format: ") +
+                                  ImageWriter::name(format));
 }
 
 }  // namespace s21
\ No newline at end of file
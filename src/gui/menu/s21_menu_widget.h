@@ -22,7 +22,7 @@ class MenuWidget : public QWidget {
   /// @param parent Указатель на родительское окно
   /// @param mainSettings Указатель на настройки
   explicit MenuWidget(QWidget *parent = nullptr,
-                      QSettings *mainSettings = nullptr);
+                      RenderSettings *mainSettings = nullptr);
   /// @brief Деструктор
   ~MenuWidget();
 
@@ -34,13 +34,20 @@ class MenuWidget : public QWidget {
   /// @brief сигнал скриншота
   /// @param directory путь куда сохранять
   void screenshotSignal(QString directory);
+  /// @brief сигнал скриншота высокого разрешения
+  /// @param directory путь куда сохранять
+  void largeScreenshotSignal(QString directory);
   /// @brief сигнал записи видео
   /// @param directory путь куда сохранять
   void captureVideoSignal(QString directory);
+  /// @brief сигнал записи GIF
+  /// @param directory путь куда сохранять
+  void captureGifSignal(QString directory);
+  /// @brief сигнал внеэкранной отрисовки видео с вращением моделей
+  /// @param files пути к моделям
+  void renderTurntableSignal(QStringList files);
   /// @brief Сигнал сброса трансформаций
   void resetTransformationPressed();
-  /// @brief сигнал изменения настроек
-  void settingsChanged();
 
  private:
   /// @brief создание кнопок
@@ -56,10 +63,26 @@ class MenuWidget : public QWidget {
   void openPressed();
   /// @brief нажатие на кнопку смены проекции
   void toggleProjectionPressed();
+  /// @brief нажатие на кнопку смены режима отображения
+  void toggleDisplayModePressed();
+  /// @brief нажатие на кнопку динамического разрешения
+  void toggleDynamicResolutionPressed();
+  /// @brief нажатие на кнопку хранения геометрии только в видеопамяти
+  void toggleGpuResidentPressed();
+  /// @brief нажатие на кнопку смены формата скриншотов
+  void toggleScreenshotFormatPressed();
+  /// @brief обновление текста кнопки формата скриншотов
+  void updateScreenshotFormat();
   /// @brief нажатие на кнопку скриншота
   void screenshotPressed();
+  /// @brief нажатие на кнопку скриншота высокого разрешения
+  void largeScreenshotPressed();
   /// @brief нажатие на кнопку захвата видео
   void captureVideoPressed();
+  /// @brief нажатие на кнопку захвата GIF
+  void captureGifPressed();
+  /// @brief нажатие на кнопку отрисовки видео с вращением моделей
+  void renderTurntablePressed();
 
   /// @brief создание лэйаута
   void createLayout();
@@ -70,16 +93,30 @@ class MenuWidget : public QWidget {
   QPushButton *buttonOpenModel;
   /// @brief Указатель на кнопку смены прекции
   QPushButton *buttonToggleProjection;
+  /// @brief Указатель на кнопку смены режима отображения
+  QPushButton *buttonDisplayMode;
+  /// @brief Указатель на кнопку динамического разрешения
+  QPushButton *buttonDynamicResolution;
+  /// @brief Указатель на кнопку хранения геометрии только в видеопамяти
+  QPushButton *buttonGpuResident;
   /// @brief Указатель на кнопку сброса трансформаций
   QPushButton *buttonReset;
+  /// @brief Указатель на кнопку смены формата скриншотов
+  QPushButton *buttonScreenshotFormat;
   /// @brief Указатель на кнопку скриншота
   QPushButton *buttonScreenshot;
+  /// @brief Указатель на кнопку скриншота высокого разрешения
+  QPushButton *buttonLargeScreenshot;
   /// @brief Указатель на кнопку записи видео
   QPushButton *buttonCaptureVideo;
+  /// @brief Указатель на кнопку записи GIF
+  QPushButton *buttonCaptureGif;
+  /// @brief Указатель на кнопку отрисовки видео с вращением моделей
+  QPushButton *buttonTurntable;
   /// @brief Строку для ввода пути
   QLineEdit *pathLine;
   /// @brief Указатель на настройки
-  QSettings *settings;
+  RenderSettings *settings;
 };
 
 }  // namespace s21
@@ -7,13 +7,12 @@ int main(int argc, char *argv[]) {
   QApplication app(argc, argv);
   Q_INIT_RESOURCE(resources);
 
-  QSurfaceFormat format;
-  format.setVersion(2, 1);
-  format.setProfile(QSurfaceFormat::NoProfile);
+  QSurfaceFormat format = s21::Renderer::preferredFormat();
+  format.setSwapInterval(1);
   QSurfaceFormat::setDefaultFormat(format);
 
   s21::MainWindow viewer;
   viewer.setWindowTitle("3D Viewer");
   viewer.show();
   return app.exec();
-}
+}
\ No newline at end of file
@@ -5,24 +5,55 @@ namespace s21 {
 MainWindow::MainWindow() {
   QCoreApplication::setOrganizationName("s21");
   QCoreApplication::setApplicationName("3D_Viewer");
+  renderSettings = new RenderSettings(&settings);
   initSettings();
 
   centralWidget = new QWidget(this);
   centralWidget->setStyleSheet(MAIN_BG_STYLESHEET);
 
-  menuWidget = new MenuWidget(this, &settings);
+  menuWidget = new MenuWidget(this, renderSettings);
   informationWidget = new InformationWidget(this);
-  controlWidget = new ControlWidget(this, &settings);
+  controlWidget = new ControlWidget(this, renderSettings);
 
   exitButton = new QPushButton("Exit", this);
   exitButton->setStyleSheet(BUTTON_STYLE);
   exitButton->setFixedSize(BUTTON_W, BUTTON_H);
   connect(exitButton, &QPushButton::clicked, qApp, &QApplication::quit);
 
-  timer = new QTimer(this);
-  connect(timer, &QTimer::timeout, this, &MainWindow::captureFrame);
+  fieldWidget = new ViewerWidget(this, renderSettings);
+  connect(fieldWidget, &ViewerWidget::frameCaptured, this,
+          &MainWindow::captureFrame);
+  connect(fieldWidget, &ViewerWidget::geometryRestoreFailed, this,
+          &MainWindow::showErrorMessage);
+  connect(fieldWidget, &ViewerWidget::tiledScreenshotSaved, this,
+          [this](const QString &path, bool saved) {
+            if (!saved) {
+              QMessageBox msgBox;
+              msgBox.setText("Не удалось сохранить " + path);
+              msgBox.exec();
+            }
+          });
+
+  imageSaver = new ImageSaver();
+  connect(imageSaver, &ImageSaver::imageSaved, this,
+          [this](const QString &path, bool saved, const QString &format,
+                 double milliseconds) {
+            if (saved) {
+              qobject_cast<InformationWidget *>(informationWidget)
+                  ->updateSaveTime(format, milliseconds);
+            } else {
+              QMessageBox msgBox;
+              msgBox.setText("Не удалось сохранить " + path);
+              msgBox.exec();
+            }
+          });
 
-  fieldWidget = new ViewerWidget(this, &settings);
+  timer = new QTimer(this);
+  connect(timer, &QTimer::timeout, fieldWidget,
+          &ViewerWidget::requestCapture);
+  connect(fieldWidget, &ViewerWidget::frameRendered,
+          qobject_cast<InformationWidget *>(informationWidget),
+          &InformationWidget::updateFrameStatistics);
 
   initLayout();
 
@@ -51,6 +82,15 @@ MainWindow::~MainWindow() {
   if (exitButton) exitButton->deleteLater();
   if (timer) timer->deleteLater();
   if (progressBar) progressBar->deleteLater();
+  if (turntableProgress) turntableProgress->deleteLater();
+  delete encoder;
+  encoder = nullptr;
+  delete imageSaver;
+  imageSaver = nullptr;
+  delete offlineRenderer;
+  offlineRenderer = nullptr;
+  delete renderSettings;
+  renderSettings = nullptr;
 }
 
 void MainWindow::openModel(QString pathToFile) {
@@ -60,47 +100,98 @@ void MainWindow::openModel(QString pathToFile) {
     actingWidget = nullptr;
   }
   if (status == Status_e::OK) {
-    fieldWidget->update();
+    fieldWidget->refresh();
     qobject_cast<InformationWidget *>(informationWidget)
         ->updateInformation(pathToFile, fieldWidget->getVerticesSize(),
+                            fieldWidget->getDisplayedSize(),
                             fieldWidget->getEdgesSize());
   } else {
     showErrorMessage(status);
   }
   qobject_cast<ControlWidget *>(controlWidget)->setToDefault();
-  fieldWidget->update();
+  fieldWidget->refresh();
 }
 
 void MainWindow::captureScreenshot(QString directory) {
+  if (!directory.endsWith('/')) {
+    directory += '/';
+  }
+  const RenderSettingsData &data = renderSettings->data();
+  ImageFormat_e format = static_cast<ImageFormat_e>(data.screenshotFormat);
+  QString pathToFile =
+      directory + "screenshot_" +
+      QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") +
+      ImageWriter::extension(format);
+  imageSaver->save(fieldWidget->takeScreenshot(), pathToFile, format,
+                   data.screenshotQuality);
+}
+
+void MainWindow::captureLargeScreenshot(QString directory) {
   if (!directory.endsWith('/')) {
     directory += '/';
   }
   QString pathToFile =
       directory + "screenshot_" +
-      QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") + ".png";
-  fieldWidget->takeScreenshot().save(pathToFile, "PNG");
+      QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") + "_large.png";
+  QSize window = fieldWidget->size().expandedTo(QSize(1, 1));
+  int height = static_cast<int>(std::lround(
+      static_cast<double>(LARGE_SCREENSHOT_W) * window.height() /
+      window.width()));
+  fieldWidget->saveTiledScreenshot(pathToFile,
+                                   QSize(LARGE_SCREENSHOT_W, height));
 }
 
 void MainWindow::captureVideo(QString directory) {
+  startCapture(directory, ".avi");
+}
+
+void MainWindow::captureGif(QString directory) {
+  startCapture(directory, ".gif");
+}
+
+void MainWindow::startCapture(QString directory, const QString &extension) {
+  if (encoder) return;
   if (!directory.endsWith('/')) {
     directory += '/';
   }
   videoPathFile = directory + "video_" +
                   QDateTime::currentDateTime().toString("yyyyMMdd_hhmmss") +
-                  ".avi";
-  frames.clear();
+                  extension;
+  encoder = new VideoEncoder(videoPathFile, FPS);
+  connect(encoder, &VideoEncoder::frameEncoded, this, [this](int frames) {
+    if (progressBar) progressBar->setValue(frames * 100 / (FPS * VIDEO_LEN));
+  });
+  connect(encoder, &VideoEncoder::encodingFinished,
+          qobject_cast<InformationWidget *>(informationWidget),
+          &InformationWidget::updateEncodeRate);
+  connect(encoder, &QThread::finished, this, &MainWindow::videoEncoded);
+  encoder->start();
+  capturedFrames = 0;
+  progressBar = setupProgressBar(0);
   timer->start(1000 / FPS);
 }
 
-void MainWindow::captureFrame() {
-  frames.push_back(fieldWidget->grabFramebuffer());
-  if (frames.size() >= FPS * VIDEO_LEN) {
+void MainWindow::captureFrame(const QImage &frame) {
+  if (!encoder || capturedFrames >= FPS * VIDEO_LEN) return;
+  if (encoder->pushFrame(frame)) ++capturedFrames;
+  if (capturedFrames >= FPS * VIDEO_LEN) {
     timer->stop();
-    createVideo();
-    QMessageBox msgBox;
-    msgBox.setText("Done");
-    msgBox.exec();
+    fieldWidget->stopCapture();
+    encoder->finish();
+  }
+}
+
+void MainWindow::videoEncoded() {
+  bool succeeded = encoder->succeeded();
+  encoder->deleteLater();
+  encoder = nullptr;
+  if (progressBar) {
+    progressBar->deleteLater();
+    progressBar = nullptr;
   }
+  QMessageBox msgBox;
+  msgBox.setText(succeeded ? "Done" : "Не удалось записать видео");
+  msgBox.exec();
 }
 
 void MainWindow::showErrorMessage(Status_e status) {
@@ -135,28 +226,10 @@ void MainWindow::initSettings() {
     settings.clear();
     settings.setValue("initialized", true);
     settings.setValue("resetSettings", false);
-    settings.setValue("isOrtho", true);
-    settings.setValue("verticesColorRed", 255);
-    settings.setValue("verticesColorGreen", 255);
-    settings.setValue("verticesColorBlue", 255);
-    settings.setValue("backgroundColorRed", 0);
-    settings.setValue("backgroundColorGreen", 0);
-    settings.setValue("backgroundColorBlue", 0);
-    settings.setValue("edgesColorRed", 255);
-    settings.setValue("edgesColorGreen", 255);
-    settings.setValue("edgesColorBlue", 255);
-    settings.setValue("verticesSize", 2);
-    settings.setValue("edgesSize", 1);
-    settings.setValue("verticesStyle", 1);
-    settings.setValue("edgesStyle", 0);
+    renderSettings->resetToDefaults();
   }
 }
 
-void MainWindow::updateFromSettings() {
-  initSettings();
-  fieldWidget->update();
-}
-
 void MainWindow::updateTransformation(TransformationName_e transformation,
                                       float delta) {
   fieldWidget->transformation(transformation, delta);
@@ -180,48 +253,61 @@ void MainWindow::mousePressEvent(QMouseEvent *event) {
   QWidget::mousePressEvent(event);
 }
 
-void MainWindow::createVideo() {
-  int width = frames[0].width();
-  int height = frames[0].height();
-
-  cv::VideoWriter videoWriter(videoPathFile.toStdString(),
-                              cv::VideoWriter::fourcc('M', 'J', 'P', 'G'), FPS,
-                              cv::Size(width, height));
+void MainWindow::renderTurntable(QStringList files) {
+  if (offlineRenderer || files.isEmpty()) return;
+  offlineRenderer = new OfflineRenderer(
+      renderSettings->data(), Animation::turntable(TURNTABLE_LEN),
+      QSize(TURNTABLE_W, TURNTABLE_H), TURNTABLE_FPS);
+  for (const QString &file : files) {
+    QFileInfo info(file);
+    offlineRenderer->addJob(
+        {file, info.path() + "/" + info.completeBaseName() + "_turntable.avi"});
+  }
+  int total = static_cast<int>(offlineRenderer->frameCount() *
+                               offlineRenderer->jobCount());
+  int frames = static_cast<int>(offlineRenderer->frameCount());
+  connect(offlineRenderer, &OfflineRenderer::frameRendered, this,
+          [this, total, frames](int job, int frame) {
+            if (turntableProgress) {
+              turntableProgress->setValue((job * frames + frame) * 100 /
+                                          total);
+            }
+          });
+  connect(offlineRenderer, &OfflineRenderer::jobFinished, this,
+          [this](int, Status_e status) {
+            if (status != Status_e::OK) ++failedJobs;
+          });
+  connect(offlineRenderer, &QThread::finished, this,
+          &MainWindow::turntableRendered);
+  failedJobs = 0;
+  turntableProgress = setupProgressBar(1);
+  offlineRenderer->start();
+}
 
-  if (!videoWriter.isOpened()) {
-    qWarning("Failed to open video writer.");
-  } else {
-    int totalFrames = frames.size();
-    setupProgressBar();
-    for (int i = 0; i < totalFrames; ++i) {
-      const QImage &frame = frames[i];
-      cv::Mat mat(frame.height(), frame.width(), CV_8UC4,
-                  const_cast<uchar *>(frame.bits()), frame.bytesPerLine());
-      cv::cvtColor(mat, mat, cv::COLOR_RGBA2RGB);
-
-      videoWriter.write(mat);
-
-      int progress =
-          static_cast<int>((static_cast<double>(i) / totalFrames) * 100);
-      progressBar->setValue(progress);
-      QApplication::processEvents();
-    }
-
-    videoWriter.release();
-    progressBar->deleteLater();
-    progressBar = nullptr;
+void MainWindow::turntableRendered() {
+  offlineRenderer->deleteLater();
+  offlineRenderer = nullptr;
+  if (turntableProgress) {
+    turntableProgress->deleteLater();
+    turntableProgress = nullptr;
   }
-  frames.clear();
+  QMessageBox msgBox;
+  msgBox.setText(failedJobs ? QString("Done, failed to open %1 models")
+                                  .arg(failedJobs)
+                            : QString("Done"));
+  msgBox.exec();
 }
 
-void MainWindow::setupProgressBar() {
-  progressBar = new QProgressBar(this);
-  progressBar->setRange(0, 100);
-  progressBar->setValue(0);
-  progressBar->setStyleSheet(PROGRESS_STYLE);
-  progressBar->setGeometry((width() - PROGRESS_W) / 2,
-                           (height() - PROGRESS_H) / 2, PROGRESS_W, PROGRESS_H);
-  progressBar->show();
+QProgressBar *MainWindow::setupProgressBar(int row) {
+  QProgressBar *bar = new QProgressBar(this);
+  bar->setRange(0, 100);
+  bar->setValue(0);
+  bar->setStyleSheet(PROGRESS_STYLE);
+  bar->setGeometry((width() - PROGRESS_W) / 2,
+                   (height() - PROGRESS_H) / 2 + row * 2 * PROGRESS_H,
+                   PROGRESS_W, PROGRESS_H);
+  bar->show();
+  return bar;
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -10,13 +10,15 @@
 #ifndef S21_FRONTEND_H
 #define S21_FRONTEND_H
 
-#include <opencv2/opencv.hpp>
-
+#include "OpenGL/s21_offline_renderer.h"
 #include "OpenGL/s21_viewer_widget.h"
 #include "control/s21_control_widget.h"
+#include "image/s21_image_saver.h"
 #include "infortmation/s21_information_widget.h"
 #include "menu/s21_menu_widget.h"
 #include "s21_gui_defines.h"
+#include "s21_render_settings.h"
+#include "video/s21_video_encoder.h"
 
 namespace s21 {
 
@@ -35,18 +37,28 @@ class MainWindow : public QMainWindow {
   /// @param pathToFile Путь к файлу с моделью.
   void openModel(QString pathToFile);
   /// @brief Сохраняет текущий кадр сцены в виде изображения в указанной
-  /// директории.
+  /// директории. Формат берется из настроек, кодирование идет в фоне.
   /// @param directory Директория для сохранения скриншота.
   void captureScreenshot(QString directory);
+  /// @brief Сохраняет сцену в виде изображения шириной LARGE_SCREENSHOT_W с
+  /// пропорциями окна, отрисованного по плиткам.
+  /// @param directory Директория для сохранения скриншота.
+  void captureLargeScreenshot(QString directory);
   /// @brief Запускает захват видеозаписи текущей сцены и сохраняет её в
   /// указанной директории.
   /// @param directory Директория для сохранения видео.
   void captureVideo(QString directory);
+  /// @brief Запускает захват анимированного GIF текущей сцены и сохраняет его
+  /// в указанной директории.
+  /// @param directory Директория для сохранения GIF.
+  void captureGif(QString directory);
+  /// @brief Запускает внеэкранную отрисовку видео с вращением каждой модели.
+  /// Видео сохраняется рядом с моделью с суффиксом _turntable.
+  /// @param files Пути к моделям.
+  void renderTurntable(QStringList files);
   /// @brief Сбрасывает текущие трансформации объекта, возвращая его в исходное
   /// состояние.
   void resetTransformation();
-  /// @brief Обновляет текущие настройки виджета на основе новых данных.
-  void updateFromSettings();
   /// @brief Устанавливает новый виджет в интерфейсе.
   /// @param newWidget Указатель на новый виджет.
   void setNewWidget(QWidget *newWidget);
@@ -70,12 +82,23 @@ class MainWindow : public QMainWindow {
   /// статуса открытия модели
   /// @param status Статус, указывающий тип ошибки.
   void showErrorMessage(Status_e status);
-  /// @brief Создает видеофайл из собранных кадров.
-  void createVideo();
-  /// @brief Захватывает текущий кадр и добавляет его в видеопоследовательность.
-  void captureFrame();
+  /// @brief Создает поток кодирования и запускает захват кадров по таймеру.
+  /// @param directory Директория для сохранения.
+  /// @param extension Расширение файла, определяет формат.
+  void startCapture(QString directory, const QString &extension);
+  /// @brief Передает прочитанный кадр потоку кодирования.
+  /// Если очередь кодирования заполнена, кадр берется на следующем тике.
+  /// @param frame Кадр из framebuffer виджета
+  void captureFrame(const QImage &frame);
+  /// @brief Завершает запись после кодирования всех кадров.
+  void videoEncoded();
+  /// @brief Завершает внеэкранную отрисовку и сообщает о результате.
+  void turntableRendered();
   /// @brief Настраивает и отображает индикатор выполнения.
-  void setupProgressBar();
+  /// @param row Ряд индикатора: у записи видео и турнтейбла свои индикаторы,
+  /// которые не перекрываются при одновременной работе
+  /// @return Указатель на индикатор
+  QProgressBar *setupProgressBar(int row);
 
   /// @brief Указатель на центральный виджет основного окна.
   QWidget *centralWidget = nullptr;
@@ -93,14 +116,26 @@ class MainWindow : public QMainWindow {
   QPushButton *exitButton = nullptr;
   /// @brief Указатель на индикатор выполнения.
   QProgressBar *progressBar = nullptr;
+  /// @brief Указатель на индикатор отрисовки турнтейбла.
+  QProgressBar *turntableProgress = nullptr;
   /// @brief Указатель на таймер для захвата кадров.
   QTimer *timer = nullptr;
   /// @brief Объект настроек приложения.
   QSettings settings;
+  /// @brief Типизированные настройки отрисовки.
+  RenderSettings *renderSettings = nullptr;
   /// @brief Путь к файлу видеозаписи.
   QString videoPathFile;
-  /// @brief Вектор кадров для создания видео.
-  std::vector<QImage> frames;
+  /// @brief Поток кодирования текущей видеозаписи.
+  VideoEncoder *encoder = nullptr;
+  /// @brief Кол-во кадров, переданных на кодирование.
+  int capturedFrames = 0;
+  /// @brief Фоновая запись скриншотов.
+  ImageSaver *imageSaver = nullptr;
+  /// @brief Поток внеэкранной отрисовки видео.
+  OfflineRenderer *offlineRenderer = nullptr;
+  /// @brief Кол-во моделей, которые не удалось открыть при отрисовке.
+  int failedJobs = 0;
 };
 
 }  // namespace s21
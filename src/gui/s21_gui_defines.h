@@ -20,18 +20,30 @@
 #include <QLineEdit>
 #include <QMainWindow>
 #include <QMessageBox>
+#include <QOffscreenSurface>
+#include <QOpenGLContext>
+#include <QOpenGLExtraFunctions>
+#include <QOpenGLFramebufferObject>
 #include <QOpenGLShaderProgram>
+#include <QOpenGLTextureBlitter>
+#include <QOpenGLVertexArrayObject>
 #include <QOpenGLWidget>
 #include <QProgressBar>
 #include <QPushButton>
+#include <QSemaphore>
 #include <QSlider>
+#include <QThread>
+#include <QThreadPool>
 #include <QTimer>
 #include <QVBoxLayout>
 #include <QWidget>
 #include <QtGui>
+#include <deque>
 #include <functional>
+#include <map>
 #include <thread>
 
+#include "../common/s21_memory.h"
 #include "../controller/s21_controller.h"
 
 /// @brief Размер меню по вертикали
@@ -63,6 +75,26 @@
 #define SENSITIVITY_ROTATION 1.0f
 /// @brief Чувствительность трансляции
 #define SENSITIVITY_TRANSLATION 1.70f
+/// @brief Размер порции загрузки геометрии в видеопамять за кадр, байт
+#define UPLOAD_SLICE_BYTES (4 << 20)
+/// @brief Длина окна подсчета частоты кадров при перетаскивании, нс
+#define FPS_WINDOW_NS 500000000
+/// @brief Число типов трансформаций в TransformationName_e
+#define TRANSFORMATION_COUNT (TransformationName_e::RotateZ + 1)
+/// @brief Минимальный множитель при объединении шагов масштабирования
+#define MIN_SCALE_FACTOR 0.1f
+/// @brief Минимальная доля ребер и вершин при взаимодействии
+#define MIN_DETAIL 0.01f
+/// @brief Максимальный рост доли деталей за кадр
+#define DETAIL_GROWTH 1.1f
+/// @brief Минимальный масштаб разрешения при взаимодействии
+#define MIN_RESOLUTION_SCALE 0.25f
+/// @brief Шаг масштаба разрешения, на котором пересоздается буфер кадра
+#define RESOLUTION_SCALE_STEP 0.25f
+/// @brief Наибольшая целевая частота кадров в настройках
+#define MAX_TARGET_FPS 144
+/// @brief Наибольший простой ввода до полной отрисовки в настройках, мс
+#define MAX_IDLE_DELAY 2000
 
 /// @brief Цвет фона кнопки
 #define BUTTON_BG_COLOR "rgb(97, 95, 137)"
@@ -77,6 +109,33 @@
 #define FPS 10
 /// @brief Длина видео в секундах
 #define VIDEO_LEN 10
+/// @brief Глубина очереди кадров на кодирование
+#define VIDEO_QUEUE_DEPTH 8
+/// @brief Качество сжатия кадров видео в JPEG
+#define VIDEO_JPEG_QUALITY 95
+/// @brief Наибольшая сторона кадра GIF
+#define GIF_MAX_SIDE 640
+/// @brief Кол-во цветов палитры GIF
+#define GIF_COLORS 256
+/// @brief Ширина кадра видео с вращением модели
+#define TURNTABLE_W 1920
+/// @brief Высота кадра видео с вращением модели
+#define TURNTABLE_H 1080
+/// @brief Кадров в секунду видео с вращением модели
+#define TURNTABLE_FPS 30
+/// @brief Длина оборота модели в секундах
+#define TURNTABLE_LEN 6
+/// @brief Наибольшая сторона плитки при отрисовке изображения по плиткам
+#define TILE_SIZE 2048
+/// @brief Ширина скриншота высокого разрешения
+#define LARGE_SCREENSHOT_W 7680
+/// @brief Кол-во буферов пикселей асинхронного чтения кадра
+#define READBACK_BUFFERS 3
+
+#ifndef GL_BGR
+/// @brief Формат BGR отсутствует в заголовках openGL ES
+#define GL_BGR 0x80E0
+#endif
 
 /// @brief Стиль кнопки
 #define BUTTON_STYLE                           \
@@ -0,0 +1,125 @@
+#include "s21_render_settings.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Соответствие ключей хранилища полям настроек
+const std::pair<const char *, IntSetting> kIntSettings[] = {
+    {"verticesColorRed", &RenderSettingsData::verticesColorRed},
+    {"verticesColorGreen", &RenderSettingsData::verticesColorGreen},
+    {"verticesColorBlue", &RenderSettingsData::verticesColorBlue},
+    {"backgroundColorRed", &RenderSettingsData::backgroundColorRed},
+    {"backgroundColorGreen", &RenderSettingsData::backgroundColorGreen},
+    {"backgroundColorBlue", &RenderSettingsData::backgroundColorBlue},
+    {"edgesColorRed", &RenderSettingsData::edgesColorRed},
+    {"edgesColorGreen", &RenderSettingsData::edgesColorGreen},
+    {"edgesColorBlue", &RenderSettingsData::edgesColorBlue},
+    {"verticesSize", &RenderSettingsData::verticesSize},
+    {"edgesSize", &RenderSettingsData::edgesSize},
+    {"verticesStyle", &RenderSettingsData::verticesStyle},
+    {"edgesStyle", &RenderSettingsData::edgesStyle},
+    {"displayMode", &RenderSettingsData::displayMode},
+    {"targetFps", &RenderSettingsData::targetFps},
+    {"idleDelay", &RenderSettingsData::idleDelay},
+    {"dynamicResolution", &RenderSettingsData::dynamicResolution},
+    {"pointCloudResolution", &RenderSettingsData::pointCloudResolution},
+    {"gpuResident", &RenderSettingsData::gpuResident},
+    {"screenshotFormat", &RenderSettingsData::screenshotFormat},
+    {"screenshotQuality", &RenderSettingsData::screenshotQuality},
+};
+
+}  // namespace
+
+QVector4D RenderSettingsData::backgroundColor() const {
+  return QVector4D(backgroundColorRed / 255.0f, backgroundColorGreen / 255.0f,
+                   backgroundColorBlue / 255.0f, 1.0f);
+}
+
+QVector4D RenderSettingsData::verticesColor() const {
+  return QVector4D(verticesColorRed / 255.0f, verticesColorGreen / 255.0f,
+                   verticesColorBlue / 255.0f, 1.0f);
+}
+
+QVector4D RenderSettingsData::edgesColor() const {
+  return QVector4D(edgesColorRed / 255.0f, edgesColorGreen / 255.0f,
+                   edgesColorBlue / 255.0f, 1.0f);
+}
+
+float RenderSettingsData::pointSize() const { return verticesSize / 2.0f; }
+
+float RenderSettingsData::lineWidth() const { return edgesSize / 10.0f; }
+
+LoadOptions_t RenderSettingsData::loadOptions() const {
+  LoadOptions_t options;
+  options.faces = displayMode != DisplayMode_e::Wireframe_e ||
+                  edgesStyle == EdgesStyle_e::HiddenLineEdges_e ||
+                  edgesStyle == EdgesStyle_e::TriangleEdges_e;
+  options.edges = edgesStyle != EdgesStyle_e::HiddenLineEdges_e &&
+                  edgesStyle != EdgesStyle_e::TriangleEdges_e;
+  return options;
+}
+
+RenderSettings::RenderSettings(QSettings *set, QObject *parent)
+    : QObject{parent}, storage(set) {
+  saveTimer.setSingleShot(true);
+  saveTimer.setInterval(SETTINGS_SAVE_DELAY);
+  connect(&saveTimer, &QTimer::timeout, this, &RenderSettings::save);
+  load();
+}
+
+RenderSettings::~RenderSettings() { save(); }
+
+const RenderSettingsData &RenderSettings::data() const { return values; }
+
+int RenderSettings::value(IntSetting field) const { return values.*field; }
+
+void RenderSettings::setValue(IntSetting field, int value) {
+  if (values.*field != value) {
+    values.*field = value;
+    markDirty();
+  }
+}
+
+void RenderSettings::setOrtho(bool ortho) {
+  if (values.isOrtho != ortho) {
+    values.isOrtho = ortho;
+    markDirty();
+  }
+}
+
+void RenderSettings::resetToDefaults() {
+  values = RenderSettingsData();
+  markDirty();
+}
+
+void RenderSettings::load() {
+  RenderSettingsData defaults;
+  values.isOrtho = storage->value("isOrtho", defaults.isOrtho).toBool();
+  values.threadedRendering =
+      storage->value("threadedRendering", defaults.threadedRendering).toBool();
+  for (const auto &[key, field] : kIntSettings) {
+    values.*field = storage->value(key, defaults.*field).toInt();
+  }
+}
+
+void RenderSettings::save() {
+  if (dirty) {
+    saveTimer.stop();
+    storage->setValue("isOrtho", values.isOrtho);
+    storage->setValue("threadedRendering", values.threadedRendering);
+    for (const auto &[key, field] : kIntSettings) {
+      storage->setValue(key, values.*field);
+    }
+    storage->sync();
+    dirty = false;
+  }
+}
+
+void RenderSettings::markDirty() {
+  dirty = true;
+  saveTimer.start();
+  emit changed();
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,163 @@
+/// @mainpage
+/// @file s21_render_settings.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_RENDER_SETTINGS_H
+#define S21_RENDER_SETTINGS_H
+
+#include "image/s21_image_writer.h"
+#include "s21_gui_defines.h"
+
+/// @brief Задержка перед сохранением настроек на диск в мс
+#define SETTINGS_SAVE_DELAY 2000
+
+namespace s21 {
+
+/// @brief Режимы отображения модели
+enum DisplayMode_e { Wireframe_e, Surface_e, SurfaceEdges_e, DisplayModes_e };
+
+/// @brief Стили ребер
+enum EdgesStyle_e {
+  SolidEdges_e,
+  DashedEdges_e,
+  TriangleEdges_e,
+  HiddenLineEdges_e
+};
+
+/// @brief Типизированные значения настроек отрисовки
+struct RenderSettingsData {
+  /// @brief Ортогональная проекция
+  bool isOrtho = true;
+  /// @brief Многопоточная отрисовка
+  bool threadedRendering = false;
+  /// @brief Красная компонента цвета вершин
+  int verticesColorRed = 255;
+  /// @brief Зеленая компонента цвета вершин
+  int verticesColorGreen = 255;
+  /// @brief Синяя компонента цвета вершин
+  int verticesColorBlue = 255;
+  /// @brief Красная компонента цвета фона
+  int backgroundColorRed = 0;
+  /// @brief Зеленая компонента цвета фона
+  int backgroundColorGreen = 0;
+  /// @brief Синяя компонента цвета фона
+  int backgroundColorBlue = 0;
+  /// @brief Красная компонента цвета ребер
+  int edgesColorRed = 255;
+  /// @brief Зеленая компонента цвета ребер
+  int edgesColorGreen = 255;
+  /// @brief Синяя компонента цвета ребер
+  int edgesColorBlue = 255;
+  /// @brief Размер вершин
+  int verticesSize = 2;
+  /// @brief Толщина ребер
+  int edgesSize = 1;
+  /// @brief Стиль вершин: 0 - нет, 1 - круглые, 2 - квадратные
+  int verticesStyle = 1;
+  /// @brief Стиль ребер, значение EdgesStyle_e
+  int edgesStyle = EdgesStyle_e::SolidEdges_e;
+  /// @brief Режим отображения, значение DisplayMode_e
+  int displayMode = DisplayMode_e::Wireframe_e;
+  /// @brief Целевая частота кадров при взаимодействии, 0 - без упрощения
+  int targetFps = 30;
+  /// @brief Простой ввода до отрисовки модели целиком, мс
+  int idleDelay = 200;
+  /// @brief Пониженное разрешение при взаимодействии: 0 - нет, 1 - да
+  int dynamicResolution = 0;
+  /// @brief Вокселей по наибольшей оси облака точек, 0 - без прореживания.
+  /// Применяется при загрузке модели
+  int pointCloudResolution = 1024;
+  /// @brief Освобождение геометрии в оперативной памяти после загрузки в
+  /// видеопамять: 0 - нет, 1 - да
+  int gpuResident = 0;
+  /// @brief Формат скриншотов, значение ImageFormat_e
+  int screenshotFormat = ImageFormat_e::Png_e;
+  /// @brief Качество JPEG скриншотов от 0 до 100
+  int screenshotQuality = SCREENSHOT_JPEG_QUALITY;
+
+  /// @brief Цвет фона для openGL
+  /// @return Цвет в диапазоне [0, 1]
+  QVector4D backgroundColor() const;
+  /// @brief Цвет вершин для openGL
+  /// @return Цвет в диапазоне [0, 1]
+  QVector4D verticesColor() const;
+  /// @brief Цвет ребер для openGL
+  /// @return Цвет в диапазоне [0, 1]
+  QVector4D edgesColor() const;
+  /// @brief Размер точки для glPointSize
+  /// @return Размер в пикселях
+  float pointSize() const;
+  /// @brief Толщина линии для glLineWidth
+  /// @return Толщина в пикселях
+  float lineWidth() const;
+  /// @brief Параметры загрузки модели: поверхности строятся сразу, только
+  /// если их рисует режим отображения или стиль ребер, а ребра - только
+  /// если они рисуются не по треугольникам поверхности
+  /// @return Параметры загрузки
+  LoadOptions_t loadOptions() const;
+};
+
+/// @brief Указатель на целочисленное поле настроек
+using IntSetting = int RenderSettingsData::*;
+
+/// @brief Класс настроек отрисовки с оповещением об изменениях.
+/// Значения хранятся в памяти, на диск они сохраняются пакетно по таймеру
+/// простоя и при уничтожении объекта.
+class RenderSettings : public QObject {
+  Q_OBJECT
+ public:
+  /// @brief Конструктор, считывает сохраненные настройки
+  /// @param set Указатель на хранилище настроек
+  /// @param parent Указатель на родителя
+  explicit RenderSettings(QSettings *set, QObject *parent = nullptr);
+  /// @brief Деструктор, сохраняет несохраненные изменения
+  ~RenderSettings();
+
+  /// @brief Доступ к значениям настроек
+  /// @return Ссылка на значения
+  const RenderSettingsData &data() const;
+  /// @brief Получение целочисленной настройки
+  /// @param field Поле настроек
+  /// @return Значение
+  int value(IntSetting field) const;
+  /// @brief Изменение целочисленной настройки
+  /// @param field Поле настроек
+  /// @param value Новое значение
+  void setValue(IntSetting field, int value);
+  /// @brief Изменение проекции
+  /// @param ortho Ортогональная проекция
+  void setOrtho(bool ortho);
+  /// @brief Сброс настроек к значениям по умолчанию
+  void resetToDefaults();
+
+  /// @brief Считывание настроек из хранилища
+  void load();
+  /// @brief Запись настроек в хранилище, если они менялись
+  void save();
+
+ signals:
+  /// @brief Сигнал об изменении настроек
+  void changed();
+
+ private:
+  /// @brief Отмечает изменения и откладывает сохранение
+  void markDirty();
+
+  /// @brief Значения настроек
+  RenderSettingsData values;
+  /// @brief Хранилище настроек
+  QSettings *storage = nullptr;
+  /// @brief Таймер отложенного сохранения
+  QTimer saveTimer;
+  /// @brief Есть несохраненные изменения
+  bool dirty = false;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -2,24 +2,23 @@
 precision mediump float;
 #endif
 
-varying vec4 frag_color;
-uniform bool isDashed;
-uniform bool isLine;
+uniform vec4 color;
+#ifdef DASHED
 varying float distance;
 
-void main() {
-    if (isDashed && isLine) {
-        float dashSize = 0.02;
-        float gapSize = 0.008;
-        float cycleSize = dashSize + gapSize;
-        float currentPos = mod(distance, cycleSize);
+const float dashSize = 0.02;
+const float gapSize = 0.008;
+#endif
 
-        if (currentPos < dashSize) {
-            gl_FragColor = frag_color;
-        } else {
-            discard;
-        }
-    } else {
-        gl_FragColor = frag_color;
+void main() {
+#if defined(DASHED)
+    if (mod(distance, dashSize + gapSize) >= dashSize) {
+        discard;
     }
+#elif defined(ROUND_POINTS)
+    if (length(gl_PointCoord - vec2(0.5)) > 0.5) {
+        discard;
+    }
+#endif
+    FRAG_COLOR = color;
 }
\ No newline at end of file
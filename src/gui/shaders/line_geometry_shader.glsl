@@ -0,0 +1,31 @@
+layout(lines) in;
+layout(triangle_strip, max_vertices = 4) out;
+
+uniform float lineWidth;
+uniform vec2 viewportSize;
+#ifdef DASHED
+in float vertexDistance[];
+out float distance;
+#endif
+
+void main() {
+    vec2 first = gl_in[0].gl_Position.xy / gl_in[0].gl_Position.w;
+    vec2 second = gl_in[1].gl_Position.xy / gl_in[1].gl_Position.w;
+    vec2 direction = (second - first) * viewportSize;
+    vec2 normal = length(direction) > 0.0
+                      ? normalize(vec2(-direction.y, direction.x))
+                      : vec2(0.0, 1.0);
+    vec2 offset = normal * lineWidth / viewportSize;
+    for (int i = 0; i < 2; ++i) {
+        for (int side = -1; side <= 1; side += 2) {
+            vec4 position = gl_in[i].gl_Position;
+            gl_Position = position + vec4(offset * side * position.w, 0.0,
+                                          0.0);
+#ifdef DASHED
+            distance = vertexDistance[i];
+#endif
+            EmitVertex();
+        }
+    }
+    EndPrimitive();
+}
\ No newline at end of file
@@ -0,0 +1,11 @@
+#ifdef GL_ES
+precision mediump float;
+#endif
+
+uniform vec4 color;
+varying vec3 normal;
+
+void main() {
+    float diffuse = abs(normalize(normal).z);
+    FRAG_COLOR = vec4(color.rgb * (0.25 + 0.75 * diffuse), color.a);
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#ifdef GL_ES
+precision mediump int;
+precision mediump float;
+#endif
+
+uniform mat4 mvp_matrix;
+uniform mat4 model_matrix;
+attribute vec3 vertex_pos;
+attribute vec3 vertex_normal;
+varying vec3 normal;
+
+void main() {
+    gl_Position = mvp_matrix * vec4(vertex_pos, 1.0);
+    normal = mat3(model_matrix) * vertex_normal;
+}
\ No newline at end of file
@@ -3,14 +3,19 @@ precision mediump int;
 precision mediump float;
 #endif
 
+#ifdef WIDE_LINES
+#define distance vertexDistance
+#endif
+
 uniform mat4 mvp_matrix;
 attribute vec3 vertex_pos;
-uniform vec4 color;
-varying vec4 frag_color;
+#ifdef DASHED
 varying float distance;
+#endif
 
 void main() {
     gl_Position = mvp_matrix * vec4(vertex_pos, 1.0);
-    frag_color = color;
+#ifdef DASHED
     distance = length(vertex_pos);
+#endif
 }
\ No newline at end of file
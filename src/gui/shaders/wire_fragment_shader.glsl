@@ -0,0 +1,16 @@
+uniform vec4 color;
+uniform float lineWidth;
+noperspective in vec3 barycentric;
+flat in uint mask;
+
+void main() {
+    vec3 distance = barycentric / fwidth(barycentric);
+    vec3 hidden = vec3((mask & 2u) == 0u, (mask & 4u) == 0u,
+                       (mask & 1u) == 0u);
+    distance = mix(distance, vec3(1e6), hidden);
+    float edge = min(distance.x, min(distance.y, distance.z));
+    if (edge > lineWidth * 0.5) {
+        discard;
+    }
+    FRAG_COLOR = color;
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+layout(triangles) in;
+layout(triangle_strip, max_vertices = 3) out;
+
+uniform usamplerBuffer edgeMasks;
+noperspective out vec3 barycentric;
+flat out uint mask;
+
+void main() {
+    uint edges = texelFetch(edgeMasks, gl_PrimitiveIDIn).r;
+    for (int i = 0; i < 3; ++i) {
+        gl_Position = gl_in[i].gl_Position;
+        barycentric = vec3(i == 0, i == 1, i == 2);
+        mask = edges;
+        EmitVertex();
+    }
+    EndPrimitive();
+}
\ No newline at end of file
@@ -0,0 +1,6 @@
+uniform mat4 mvp_matrix;
+attribute vec3 vertex_pos;
+
+void main() {
+    gl_Position = mvp_matrix * vec4(vertex_pos, 1.0);
+}
\ No newline at end of file
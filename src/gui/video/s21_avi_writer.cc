@@ -0,0 +1,166 @@
+#include "s21_avi_writer.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Смещение размера файла RIFF
+constexpr std::uint32_t kRiffSize = 4;
+/// @brief Смещение кол-ва кадров в avih
+constexpr std::uint32_t kTotalFrames = 48;
+/// @brief Смещение размера буфера в avih
+constexpr std::uint32_t kAviBuffer = 60;
+/// @brief Смещение длины потока в strh
+constexpr std::uint32_t kStreamLength = 140;
+/// @brief Смещение размера буфера в strh
+constexpr std::uint32_t kStreamBuffer = 144;
+/// @brief Смещение размера списка movi
+constexpr std::uint32_t kMoviSize = 216;
+/// @brief Флаг наличия индекса
+constexpr std::uint32_t kHasIndex = 0x10;
+/// @brief Флаг ключевого кадра в индексе
+constexpr std::uint32_t kKeyFrame = 0x10;
+/// @brief Размер заголовка блока: код и длина
+constexpr std::uint64_t kChunkHeader = 8;
+/// @brief Размер записи индекса idx1
+constexpr std::uint64_t kIndexEntry = 16;
+
+}  // namespace
+
+AviWriter::~AviWriter() { close(); }
+
+bool AviWriter::open(const std::string &path, int width, int height,
+                     int fps) {
+  close();
+  file.open(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return false;
+  index.clear();
+  maxFrame = 0;
+
+  putCode("RIFF");
+  put32(0);
+  putCode("AVI ");
+
+  putCode("LIST");
+  put32(192);
+  putCode("hdrl");
+  putCode("avih");
+  put32(56);
+  put32(static_cast<std::uint32_t>(1000000 / std::max(fps, 1)));
+  put32(0);
+  put32(0);
+  put32(kHasIndex);
+  put32(0);
+  put32(0);
+  put32(1);
+  put32(0);
+  put32(static_cast<std::uint32_t>(width));
+  put32(static_cast<std::uint32_t>(height));
+  for (int i = 0; i < 4; ++i) put32(0);
+
+  putCode("LIST");
+  put32(116);
+  putCode("strl");
+  putCode("strh");
+  put32(56);
+  putCode("vids");
+  putCode("MJPG");
+  put32(0);
+  put16(0);
+  put16(0);
+  put32(0);
+  put32(1);
+  put32(static_cast<std::uint32_t>(fps));
+  put32(0);
+  put32(0);
+  put32(0);
+  put32(0xFFFFFFFF);
+  put32(0);
+  put16(0);
+  put16(0);
+  put16(static_cast<std::uint16_t>(width));
+  put16(static_cast<std::uint16_t>(height));
+  putCode("strf");
+  put32(40);
+  put32(40);
+  put32(static_cast<std::uint32_t>(width));
+  put32(static_cast<std::uint32_t>(height));
+  put16(1);
+  put16(24);
+  putCode("MJPG");
+  put32(static_cast<std::uint32_t>(width * height * 3));
+  for (int i = 0; i < 4; ++i) put32(0);
+
+  putCode("LIST");
+  put32(0);
+  moviOffset = static_cast<std::uint32_t>(file.tellp());
+  putCode("movi");
+  return file.good();
+}
+
+bool AviWriter::isOpened() const { return file.is_open(); }
+
+bool AviWriter::writeFrame(const std::vector<unsigned char> &jpeg) {
+  if (!file.is_open() || !file.good()) return false;
+  std::uint64_t position = static_cast<std::uint64_t>(file.tellp());
+  std::uint64_t padded = jpeg.size() + jpeg.size() % 2;
+  std::uint64_t end = position + kChunkHeader + padded + kChunkHeader +
+                      (index.size() + 1) * kIndexEntry;
+  if (end > AVI_MAX_BYTES) return false;
+  std::uint32_t size = static_cast<std::uint32_t>(jpeg.size());
+  index.emplace_back(static_cast<std::uint32_t>(position) - moviOffset,
+                     size);
+  maxFrame = std::max(maxFrame, size);
+  putCode("00dc");
+  put32(size);
+  file.write(reinterpret_cast<const char *>(jpeg.data()), jpeg.size());
+  if (size % 2) file.put(0);
+  return file.good();
+}
+
+bool AviWriter::close() {
+  if (!file.is_open()) return true;
+  std::uint32_t moviEnd = static_cast<std::uint32_t>(file.tellp());
+  putCode("idx1");
+  put32(static_cast<std::uint32_t>(index.size() * 16));
+  for (const auto &[offset, size] : index) {
+    putCode("00dc");
+    put32(kKeyFrame);
+    put32(offset);
+    put32(size);
+  }
+  std::uint32_t end = static_cast<std::uint32_t>(file.tellp());
+  std::uint32_t frames = static_cast<std::uint32_t>(index.size());
+
+  patch32(kRiffSize, end - 8);
+  patch32(kTotalFrames, frames);
+  patch32(kAviBuffer, maxFrame + 8);
+  patch32(kStreamLength, frames);
+  patch32(kStreamBuffer, maxFrame + 8);
+  patch32(kMoviSize, moviEnd - moviOffset);
+  bool written = file.good();
+  file.close();
+  index.clear();
+  return written && !file.fail();
+}
+
+void AviWriter::put32(std::uint32_t value) {
+  char bytes[4] = {static_cast<char>(value), static_cast<char>(value >> 8),
+                   static_cast<char>(value >> 16),
+                   static_cast<char>(value >> 24)};
+  file.write(bytes, 4);
+}
+
+void AviWriter::put16(std::uint16_t value) {
+  char bytes[2] = {static_cast<char>(value), static_cast<char>(value >> 8)};
+  file.write(bytes, 2);
+}
+
+void AviWriter::putCode(const char *code) { file.write(code, 4); }
+
+void AviWriter::patch32(std::uint32_t offset, std::uint32_t value) {
+  file.seekp(offset);
+  put32(value);
+}
+
+}  // namespace s21
\ No newline at end of file
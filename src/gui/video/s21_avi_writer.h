@@ -0,0 +1,77 @@
+/// @mainpage
+/// @file s21_avi_writer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_AVI_WRITER_H
+#define S21_AVI_WRITER_H
+
+#include "../../common/s21_common.h"
+
+/// @brief Наибольший размер файла AVI без OpenDML. Часть программ читает
+/// размеры RIFF как знаковые, поэтому предел 2 ГБ, а не 4 ГБ
+#define AVI_MAX_BYTES 0x7FFFFFFFu
+
+namespace s21 {
+
+/// @brief Запись уже сжатых JPEG кадров в контейнер AVI (MJPG).
+/// Заголовки пишутся при открытии, размеры и кол-во кадров дописываются при
+/// закрытии вместе с индексом idx1. Без расширения OpenDML размеры и
+/// смещения 32-битные, поэтому файл с индексом ограничен AVI_MAX_BYTES:
+/// кадр, после которого файл вышел бы за предел, не записывается.
+class AviWriter {
+ public:
+  /// @brief Деструктор, закрывает файл
+  ~AviWriter();
+
+  /// @brief Открытие файла и запись заголовков
+  /// @param path Путь к файлу
+  /// @param width Ширина кадра
+  /// @param height Высота кадра
+  /// @param fps Кадров в секунду
+  /// @return false, если файл не открылся
+  bool open(const std::string &path, int width, int height, int fps);
+  /// @brief Открыт ли файл
+  /// @return true, если открыт
+  bool isOpened() const;
+  /// @brief Запись кадра в конец потока
+  /// @param jpeg Кадр в формате JPEG
+  /// @return false, если файл не открыт, кадр не помещается в AVI_MAX_BYTES
+  /// вместе с индексом или запись не удалась
+  bool writeFrame(const std::vector<unsigned char> &jpeg);
+  /// @brief Запись индекса, исправление заголовков и закрытие файла
+  /// @return false, если запись не удалась
+  bool close();
+
+ private:
+  /// @brief Запись 32-битного числа в порядке little-endian
+  /// @param value Число
+  void put32(std::uint32_t value);
+  /// @brief Запись 16-битного числа в порядке little-endian
+  /// @param value Число
+  void put16(std::uint16_t value);
+  /// @brief Запись кода из четырех символов
+  /// @param code Код
+  void putCode(const char *code);
+  /// @brief Перезапись 32-битного числа по смещению
+  /// @param offset Смещение от начала файла
+  /// @param value Число
+  void patch32(std::uint32_t offset, std::uint32_t value);
+
+  /// @brief Файл
+  std::ofstream file;
+  /// @brief Смещение кода movi, от него считаются смещения индекса
+  std::uint32_t moviOffset = 0;
+  /// @brief Смещения и размеры кадров относительно movi
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> index;
+  /// @brief Наибольший размер кадра
+  std::uint32_t maxFrame = 0;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -0,0 +1,184 @@
+#include "s21_gif_palette.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Матрица Байера 4x4
+constexpr int kBayer[4][4] = {
+    {0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+
+/// @brief Ящик медианного сечения: непрерывный диапазон ячеек
+struct Box {
+  /// @brief Первая ячейка
+  std::size_t begin;
+  /// @brief Ячейка за последней
+  std::size_t end;
+  /// @brief Кол-во пикселей
+  std::uint64_t pixels;
+};
+
+/// @brief Компонента ячейки гистограммы
+/// @param cell Номер ячейки
+/// @param axis Ось: 0 - красный, 1 - зеленый, 2 - синий
+/// @return Значение компоненты
+int component(int cell, int axis) {
+  return (cell >> (GIF_HISTOGRAM_BITS * (2 - axis))) &
+         ((1 << GIF_HISTOGRAM_BITS) - 1);
+}
+
+}  // namespace
+
+void GifPalette::build(const std::uint8_t *pixels, int width, int height,
+                       int stride, int count) {
+  std::size_t rows = static_cast<std::size_t>(height);
+  std::size_t chunks =
+      parallelWorkers(rows * width, GIF_HISTOGRAM_SIZE * 4u);
+  std::vector<std::vector<std::uint32_t>> partial(
+      chunks, std::vector<std::uint32_t>(GIF_HISTOGRAM_SIZE, 0));
+  parallelForChunks(
+      rows, chunks,
+      [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+        std::vector<std::uint32_t> &histogram = partial[chunk];
+        for (std::size_t y = begin; y < end; ++y) {
+          const std::uint8_t *row = pixels + y * stride;
+          for (int x = 0; x < width; ++x) {
+            ++histogram[cell(row[3 * x], row[3 * x + 1], row[3 * x + 2])];
+          }
+        }
+      });
+
+  std::vector<int> cells;
+  std::vector<std::uint32_t> counts(GIF_HISTOGRAM_SIZE, 0);
+  for (int c = 0; c < GIF_HISTOGRAM_SIZE; ++c) {
+    for (const std::vector<std::uint32_t> &histogram : partial) {
+      counts[c] += histogram[c];
+    }
+    if (counts[c]) cells.push_back(c);
+  }
+
+  std::vector<Box> boxes;
+  if (!cells.empty()) {
+    boxes.push_back({0, cells.size(), static_cast<std::uint64_t>(rows) *
+                                          static_cast<std::uint64_t>(width)});
+  }
+  bool splitting = true;
+  while (splitting && static_cast<int>(boxes.size()) < count) {
+    splitting = false;
+    std::size_t best = 0;
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+      if (boxes[i].end - boxes[i].begin > 1 &&
+          (!splitting || boxes[i].pixels > boxes[best].pixels)) {
+        best = i;
+        splitting = true;
+      }
+    }
+    if (splitting) {
+      Box &box = boxes[best];
+      int axis = 0;
+      int longest = -1;
+      for (int a = 0; a < 3; ++a) {
+        int low = 1 << GIF_HISTOGRAM_BITS;
+        int high = -1;
+        for (std::size_t i = box.begin; i < box.end; ++i) {
+          low = std::min(low, component(cells[i], a));
+          high = std::max(high, component(cells[i], a));
+        }
+        if (high - low > longest) {
+          longest = high - low;
+          axis = a;
+        }
+      }
+      std::sort(cells.begin() + box.begin, cells.begin() + box.end,
+                [axis](int a, int b) {
+                  return component(a, axis) < component(b, axis) ||
+                         (component(a, axis) == component(b, axis) && a < b);
+                });
+      std::uint64_t lower = 0;
+      std::size_t middle = box.begin;
+      do {
+        lower += counts[cells[middle++]];
+      } while (middle + 1 < box.end && lower * 2 < box.pixels);
+      Box upper = {middle, box.end, box.pixels - lower};
+      box.end = middle;
+      box.pixels = lower;
+      boxes.push_back(upper);
+    }
+  }
+
+  colors.assign(std::max<std::size_t>(boxes.size(), 1) * 3, 0);
+  for (std::size_t b = 0; b < boxes.size(); ++b) {
+    std::uint64_t sum[3] = {0, 0, 0};
+    for (std::size_t i = boxes[b].begin; i < boxes[b].end; ++i) {
+      for (int a = 0; a < 3; ++a) {
+        sum[a] += static_cast<std::uint64_t>(counts[cells[i]]) *
+                  ((component(cells[i], a) << (8 - GIF_HISTOGRAM_BITS)) + 4);
+      }
+    }
+    for (int a = 0; a < 3; ++a) {
+      colors[b * 3 + a] = static_cast<std::uint8_t>(
+          boxes[b].pixels ? sum[a] / boxes[b].pixels : 0);
+    }
+  }
+  lookup.assign(GIF_HISTOGRAM_SIZE, -1);
+}
+
+void GifPalette::map(const std::uint8_t *pixels, int width, int height,
+                     int stride, bool dither,
+                     std::vector<std::uint8_t> &indices) {
+  indices.resize(static_cast<std::size_t>(width) * height);
+  const int step = 1 << (8 - GIF_HISTOGRAM_BITS);
+  for (int y = 0; y < height; ++y) {
+    const std::uint8_t *row = pixels + static_cast<std::size_t>(y) * stride;
+    std::uint8_t *out = indices.data() + static_cast<std::size_t>(y) * width;
+    for (int x = 0; x < width; ++x) {
+      int r = row[3 * x];
+      int g = row[3 * x + 1];
+      int b = row[3 * x + 2];
+      if (dither) {
+        int offset = (kBayer[y & 3][x & 3] * 2 - 15) * step / 32;
+        r = std::clamp(r + offset, 0, 255);
+        g = std::clamp(g + offset, 0, 255);
+        b = std::clamp(b + offset, 0, 255);
+      }
+      out[x] = nearest(cell(r, g, b));
+    }
+  }
+}
+
+const std::vector<std::uint8_t> &GifPalette::getColors() const {
+  return colors;
+}
+
+int GifPalette::size() const { return static_cast<int>(colors.size() / 3); }
+
+int GifPalette::cell(int r, int g, int b) {
+  const int shift = 8 - GIF_HISTOGRAM_BITS;
+  return ((r >> shift) << (2 * GIF_HISTOGRAM_BITS)) |
+         ((g >> shift) << GIF_HISTOGRAM_BITS) | (b >> shift);
+}
+
+std::uint8_t GifPalette::nearest(int c) {
+  if (lookup[c] < 0) {
+    const int shift = 8 - GIF_HISTOGRAM_BITS;
+    int r = (component(c, 0) << shift) + 4;
+    int g = (component(c, 1) << shift) + 4;
+    int b = (component(c, 2) << shift) + 4;
+    int best = 0;
+    int bestDistance = std::numeric_limits<int>::max();
+    for (int i = 0; i < size(); ++i) {
+      int dr = r - colors[i * 3];
+      int dg = g - colors[i * 3 + 1];
+      int db = b - colors[i * 3 + 2];
+      int distance = dr * dr + dg * dg + db * db;
+      if (distance < bestDistance) {
+        bestDistance = distance;
+        best = i;
+      }
+    }
+    lookup[c] = static_cast<std::int16_t>(best);
+  }
+  return static_cast<std::uint8_t>(lookup[c]);
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,74 @@
+/// @mainpage
+/// @file s21_gif_palette.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_GIF_PALETTE_H
+#define S21_GIF_PALETTE_H
+
+#include "../../common/s21_parallel.h"
+
+/// @brief Бит на канал в гистограмме цветов
+#define GIF_HISTOGRAM_BITS 5
+/// @brief Кол-во ячеек гистограммы цветов
+#define GIF_HISTOGRAM_SIZE (1 << (3 * GIF_HISTOGRAM_BITS))
+
+namespace s21 {
+
+/// @brief Палитра GIF, построенная медианным сечением.
+/// Цвета кадра сводятся в гистограмму 5 бит на канал, которая считается
+/// параллельно по полосам строк. Ящик с наибольшим кол-вом пикселей делится
+/// по медиане вдоль самой длинной оси, пока не наберется нужное кол-во
+/// цветов. Ближайший цвет ищется один раз на ячейку гистограммы.
+class GifPalette {
+ public:
+  /// @brief Построение палитры по кадру RGB
+  /// @param pixels Пиксели RGB, 3 байта на пиксель
+  /// @param width Ширина кадра
+  /// @param height Высота кадра
+  /// @param stride Байт в строке
+  /// @param count Кол-во цветов, не больше 256
+  void build(const std::uint8_t *pixels, int width, int height, int stride,
+             int count);
+  /// @brief Перевод области кадра в индексы палитры. Таблица ближайших
+  /// цветов заполняется по ходу, поэтому потоки используют свои копии палитры
+  /// @param pixels Пиксели RGB области
+  /// @param width Ширина области
+  /// @param height Высота области
+  /// @param stride Байт в строке
+  /// @param dither Упорядоченное псевдосмешивание матрицей Байера 4x4
+  /// @param indices Индексы палитры, по одному на пиксель
+  void map(const std::uint8_t *pixels, int width, int height, int stride,
+           bool dither, std::vector<std::uint8_t> &indices);
+  /// @brief Цвета палитры
+  /// @return Тройки RGB
+  const std::vector<std::uint8_t> &getColors() const;
+  /// @brief Кол-во цветов
+  /// @return Кол-во цветов
+  int size() const;
+
+ private:
+  /// @brief Ячейка гистограммы цвета
+  /// @param r Красный
+  /// @param g Зеленый
+  /// @param b Синий
+  /// @return Номер ячейки
+  static int cell(int r, int g, int b);
+  /// @brief Ближайший цвет палитры для ячейки гистограммы
+  /// @param cell Номер ячейки
+  /// @return Индекс цвета
+  std::uint8_t nearest(int cell);
+
+  /// @brief Цвета палитры, тройки RGB
+  std::vector<std::uint8_t> colors;
+  /// @brief Ближайший цвет по ячейке гистограммы, -1 - еще не найден
+  std::vector<std::int16_t> lookup;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
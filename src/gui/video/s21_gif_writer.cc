@@ -0,0 +1,175 @@
+#include "s21_gif_writer.h"
+
+namespace s21 {
+
+namespace {
+
+/// @brief Наибольший код LZW
+constexpr int kMaxCode = 4095;
+/// @brief Размер хеш-таблицы словаря LZW, степень двойки
+constexpr std::size_t kTableSize = 8192;
+
+/// @brief Упаковка кодов LZW в блоки по 255 байт
+class CodePacker {
+ public:
+  /// @brief Конструктор
+  /// @param output Куда дописывать блоки
+  explicit CodePacker(std::vector<std::uint8_t> &output) : out(output) {}
+  /// @brief Запись кода младшими битами вперед
+  /// @param code Код
+  /// @param bits Бит в коде
+  void write(int code, int bits) {
+    buffer |= static_cast<std::uint32_t>(code) << count;
+    count += bits;
+    while (count >= 8) {
+      put(static_cast<std::uint8_t>(buffer));
+      buffer >>= 8;
+      count -= 8;
+    }
+  }
+  /// @brief Запись остатка битов и завершающего пустого блока
+  void finish() {
+    if (count > 0) put(static_cast<std::uint8_t>(buffer));
+    if (!block.empty()) flush();
+    out.push_back(0);
+  }
+
+ private:
+  /// @brief Добавление байта в текущий блок
+  /// @param byte Байт
+  void put(std::uint8_t byte) {
+    block.push_back(byte);
+    if (block.size() == 255) flush();
+  }
+  /// @brief Запись блока с длиной
+  void flush() {
+    out.push_back(static_cast<std::uint8_t>(block.size()));
+    out.insert(out.end(), block.begin(), block.end());
+    block.clear();
+  }
+
+  /// @brief Выходные байты
+  std::vector<std::uint8_t> &out;
+  /// @brief Текущий блок
+  std::vector<std::uint8_t> block;
+  /// @brief Неполный байт
+  std::uint32_t buffer = 0;
+  /// @brief Бит в buffer
+  int count = 0;
+};
+
+}  // namespace
+
+GifWriter::~GifWriter() { close(); }
+
+bool GifWriter::open(const std::string &path, int width, int height,
+                     int delay) {
+  close();
+  file.open(path, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) return false;
+  frameDelay = delay;
+  file.write("GIF89a", 6);
+  put16(width);
+  put16(height);
+  const char screen[3] = {0, 0, 0};
+  file.write(screen, 3);
+  const char loop[19] = {'\x21', '\xFF', 11,  'N', 'E', 'T', 'S',
+                         'C',    'A',    'P', 'E', '2', '.', '0',
+                         3,      1,      0,   0,   0};
+  file.write(loop, 19);
+  return file.good();
+}
+
+bool GifWriter::isOpened() const { return file.is_open(); }
+
+bool GifWriter::writeFrame(const GifFrame_t &frame) {
+  if (!file.is_open()) return false;
+  int bits = paletteBits(frame.palette.size() / 3);
+  bool transparent = frame.transparent >= 0;
+  file.put('\x21');
+  file.put('\xF9');
+  file.put(4);
+  file.put(static_cast<char>((1 << 2) | (transparent ? 1 : 0)));
+  put16(frameDelay);
+  file.put(static_cast<char>(transparent ? frame.transparent : 0));
+  file.put(0);
+
+  file.put('\x2C');
+  put16(frame.left);
+  put16(frame.top);
+  put16(frame.width);
+  put16(frame.height);
+  file.put(static_cast<char>(0x80 | (bits - 1)));
+  std::vector<std::uint8_t> palette(frame.palette);
+  palette.resize(static_cast<std::size_t>(3) << bits, 0);
+  file.write(reinterpret_cast<const char *>(palette.data()), palette.size());
+  file.put(static_cast<char>(frame.codeSize));
+  file.write(reinterpret_cast<const char *>(frame.data.data()),
+             frame.data.size());
+  return file.good();
+}
+
+bool GifWriter::close() {
+  if (!file.is_open()) return true;
+  file.put('\x3B');
+  bool written = file.good();
+  file.close();
+  return written && !file.fail();
+}
+
+void GifWriter::compress(const std::vector<std::uint8_t> &indices,
+                         GifFrame_t &frame) {
+  frame.codeSize = std::max(2, paletteBits(frame.palette.size() / 3));
+  frame.data.clear();
+  CodePacker packer(frame.data);
+  const int clear = 1 << frame.codeSize;
+  int bits = frame.codeSize + 1;
+  int last = clear + 1;
+  std::vector<std::uint32_t> keys(kTableSize);
+  std::vector<std::int16_t> codes(kTableSize, -1);
+
+  packer.write(clear, bits);
+  int current = -1;
+  for (std::uint8_t index : indices) {
+    if (current < 0) {
+      current = index;
+      continue;
+    }
+    std::uint32_t key = (static_cast<std::uint32_t>(current) << 8) | index;
+    std::size_t slot = (key * 2654435761u) & (kTableSize - 1);
+    while (codes[slot] >= 0 && keys[slot] != key) {
+      slot = (slot + 1) & (kTableSize - 1);
+    }
+    if (codes[slot] >= 0) {
+      current = codes[slot];
+      continue;
+    }
+    packer.write(current, bits);
+    keys[slot] = key;
+    codes[slot] = static_cast<std::int16_t>(++last);
+    if (last >= (1 << bits)) ++bits;
+    if (last == kMaxCode) {
+      packer.write(clear, bits);
+      std::fill(codes.begin(), codes.end(), -1);
+      bits = frame.codeSize + 1;
+      last = clear + 1;
+    }
+    current = index;
+  }
+  if (current >= 0) packer.write(current, bits);
+  packer.write(clear + 1, bits);
+  packer.finish();
+}
+
+void GifWriter::put16(int value) {
+  file.put(static_cast<char>(value & 0xFF));
+  file.put(static_cast<char>((value >> 8) & 0xFF));
+}
+
+int GifWriter::paletteBits(std::size_t colors) {
+  int bits = 1;
+  while ((std::size_t(1) << bits) < colors && bits < 8) ++bits;
+  return bits;
+}
+
+}  // namespace s21
\ No newline at end of file
@@ -0,0 +1,88 @@
+/// @mainpage
+/// @file s21_gif_writer.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_GIF_WRITER_H
+#define S21_GIF_WRITER_H
+
+#include "../../common/s21_common.h"
+
+namespace s21 {
+
+/// @brief Сжатый кадр GIF
+struct GifFrame_t {
+  /// @brief Левая граница области кадра
+  int left = 0;
+  /// @brief Верхняя граница области кадра
+  int top = 0;
+  /// @brief Ширина области
+  int width = 0;
+  /// @brief Высота области
+  int height = 0;
+  /// @brief Локальная палитра, тройки RGB
+  std::vector<std::uint8_t> palette;
+  /// @brief Прозрачный индекс, -1 - без прозрачности
+  int transparent = -1;
+  /// @brief Минимальный размер кода LZW
+  int codeSize = 2;
+  /// @brief Индексы, сжатые LZW
+  std::vector<std::uint8_t> data;
+};
+
+/// @brief Запись анимированного GIF89a с бесконечным повтором.
+/// Кадры сжимаются заранее через compress(), возможно в разных потоках,
+/// запись только дописывает их в файл по порядку. Каждый кадр хранит свою
+/// палитру и не стирается следующим, поэтому кадр может обновлять только
+/// изменившуюся область.
+class GifWriter {
+ public:
+  /// @brief Деструктор, закрывает файл
+  ~GifWriter();
+
+  /// @brief Открытие файла и запись заголовка
+  /// @param path Путь к файлу
+  /// @param width Ширина изображения
+  /// @param height Высота изображения
+  /// @param delay Задержка кадра в сотых долях секунды
+  /// @return false, если файл не открылся
+  bool open(const std::string &path, int width, int height, int delay);
+  /// @brief Открыт ли файл
+  /// @return true, если открыт
+  bool isOpened() const;
+  /// @brief Запись сжатого кадра
+  /// @param frame Кадр
+  /// @return false, если файл не открыт или запись не удалась
+  bool writeFrame(const GifFrame_t &frame);
+  /// @brief Запись завершающего байта и закрытие файла
+  /// @return false, если запись не удалась
+  bool close();
+
+  /// @brief Сжатие индексов кадра LZW, заполняет codeSize и data
+  /// @param indices Индексы палитры по строкам области кадра
+  /// @param frame Кадр с заполненной палитрой
+  static void compress(const std::vector<std::uint8_t> &indices,
+                       GifFrame_t &frame);
+
+ private:
+  /// @brief Запись 16-битного числа в порядке little-endian
+  /// @param value Число
+  void put16(int value);
+  /// @brief Бит на индекс палитры
+  /// @param colors Кол-во цветов
+  /// @return От 1 до 8
+  static int paletteBits(std::size_t colors);
+
+  /// @brief Файл
+  std::ofstream file;
+  /// @brief Задержка кадра в сотых долях секунды
+  int frameDelay = 10;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
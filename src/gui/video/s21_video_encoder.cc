@@ -0,0 +1,244 @@
+#include "s21_video_encoder.h"
+
+namespace s21 {
+
+VideoEncoder::VideoEncoder(const QString &file, int framesPerSecond,
+                           std::size_t depth, std::size_t workers)
+    : path(file),
+      fps(framesPerSecond),
+      queue(std::max(depth, workers)),
+      threads(workers ? workers : parallelWorkers(queue.capacity(), 1)) {
+  if (path.endsWith(".gif", Qt::CaseInsensitive)) format = VideoFormat_e::Gif_e;
+}
+
+VideoEncoder::~VideoEncoder() {
+  finish();
+  wait();
+}
+
+bool VideoEncoder::pushFrame(QImage frame) {
+  bool pushed = !finishing && queue.tryPush(std::move(frame));
+  if (pushed) available.release();
+  return pushed;
+}
+
+void VideoEncoder::finish() {
+  if (!finishing.exchange(true)) available.release();
+}
+
+void VideoEncoder::setGifOptions(const GifOptions_t &options) {
+  gifOptions = options;
+}
+
+bool VideoEncoder::succeeded() const { return !failed; }
+
+void VideoEncoder::run() {
+  bool running = true;
+  while (running) {
+    available.acquire();
+    std::vector<QImage> frames;
+    QImage frame;
+    bool popped = queue.tryPop(frame);
+    if (!popped) running = !finishing;
+    while (popped) {
+      frames.push_back(std::move(frame));
+      popped = frames.size() < threads && available.tryAcquire();
+      if (popped && !queue.tryPop(frame)) {
+        popped = false;
+        running = !finishing;
+      }
+    }
+    encode(frames);
+  }
+  bool aviClosed = avi.close();
+  bool gifClosed = gif.close();
+  if (!aviClosed || !gifClosed) failed = true;
+  if (encoded > 0 && encodeTime > 0) {
+    emit encodingFinished(encoded, encoded * 1e9 / encodeTime);
+  }
+}
+
+void VideoEncoder::encode(const std::vector<QImage> &frames) {
+  if (frames.empty() || failed) return;
+  QElapsedTimer timer;
+  timer.start();
+  if (encoded == 0) open(frames.front().size());
+  if (failed) return;
+  std::size_t workers = std::min(frames.size(), threads);
+  if (format == VideoFormat_e::Gif_e) {
+    encodeGif(frames, workers, timer);
+    return;
+  }
+  std::vector<std::vector<uchar>> images(frames.size());
+  parallelForChunks(frames.size(), workers,
+                    [this, &frames, &images](std::size_t, std::size_t begin,
+                                             std::size_t end) {
+                      for (std::size_t i = begin; i < end; ++i) {
+                        images[i] = compress(frames[i]);
+                      }
+                    });
+  for (const std::vector<uchar> &image : images) {
+    if (!avi.writeFrame(image)) {
+      failed = true;
+      return;
+    }
+    frameWritten(timer);
+  }
+}
+
+void VideoEncoder::open(const QSize &frameSize) {
+  bool opened = false;
+  size = frameSize;
+  if (format == VideoFormat_e::Gif_e) {
+    QSize bounds(gifOptions.maxSide, gifOptions.maxSide);
+    if (size.width() > bounds.width() || size.height() > bounds.height()) {
+      size = size.scaled(bounds, Qt::KeepAspectRatio).expandedTo(QSize(1, 1));
+    }
+    opened = gif.open(path.toStdString(), size.width(), size.height(),
+                      std::max(1, static_cast<int>(std::lround(100.0 / fps))));
+  } else {
+    opened = avi.open(path.toStdString(), size.width(), size.height(), fps);
+  }
+  if (!opened) {
+    qWarning("Failed to open video writer.");
+    failed = true;
+  }
+}
+
+void VideoEncoder::encodeGif(const std::vector<QImage> &frames,
+                             std::size_t workers, QElapsedTimer &timer) {
+  std::vector<QImage> images(frames.size());
+  parallelForChunks(
+      frames.size(), workers,
+      [this, &frames, &images](std::size_t, std::size_t begin,
+                               std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          QImage image = frames[i];
+          if (image.size() != size) {
+            image = image.scaled(size, Qt::IgnoreAspectRatio,
+                                 Qt::SmoothTransformation);
+          }
+          images[i] = image.convertToFormat(QImage::Format_RGB888);
+        }
+      });
+  if (gifOptions.sharedPalette && palette.size() == 0) {
+    const QImage &first = images.front();
+    palette.build(first.constBits(), first.width(), first.height(),
+                  first.bytesPerLine(), GIF_COLORS - 1);
+  }
+  std::vector<GifFrame_t> gifFrames(frames.size());
+  parallelForChunks(
+      frames.size(), workers,
+      [this, &images, &gifFrames](std::size_t, std::size_t begin,
+                                  std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          gifFrames[i] = compressGif(images[i], i ? images[i - 1] : previous);
+        }
+      });
+  previous = images.back();
+  for (const GifFrame_t &frame : gifFrames) {
+    if (!gif.writeFrame(frame)) {
+      failed = true;
+      return;
+    }
+    frameWritten(timer);
+  }
+}
+
+void VideoEncoder::frameWritten(QElapsedTimer &timer) {
+  encodeTime += timer.nsecsElapsed();
+  timer.restart();
+  emit frameEncoded(++encoded);
+}
+
+std::vector<uchar> VideoEncoder::compress(const QImage &frame) const {
+  QImage image = frame.size() == size ? frame : frame.scaled(size);
+  cv::Mat bgr;
+  if (image.format() == QImage::Format_BGR888) {
+    bgr = cv::Mat(image.height(), image.width(), CV_8UC3,
+                  const_cast<uchar *>(image.constBits()),
+                  image.bytesPerLine());
+  } else {
+    image = image.convertToFormat(QImage::Format_RGB32);
+    cv::Mat mat(image.height(), image.width(), CV_8UC4,
+                const_cast<uchar *>(image.constBits()), image.bytesPerLine());
+    cv::cvtColor(mat, bgr, cv::COLOR_BGRA2BGR);
+  }
+  std::vector<uchar> jpeg;
+  cv::imencode(".jpg", bgr, jpeg,
+               {cv::IMWRITE_JPEG_QUALITY, VIDEO_JPEG_QUALITY});
+  return jpeg;
+}
+
+GifFrame_t VideoEncoder::compressGif(const QImage &image,
+                                     const QImage &prior) const {
+  QRect rect = changedRect(image, prior);
+  if (rect.isEmpty()) rect = QRect(0, 0, 1, 1);
+  GifFrame_t frame;
+  frame.left = rect.left();
+  frame.top = rect.top();
+  frame.width = rect.width();
+  frame.height = rect.height();
+
+  int stride = image.bytesPerLine();
+  std::size_t offset =
+      static_cast<std::size_t>(rect.top()) * stride + rect.left() * 3;
+  const std::uint8_t *pixels = image.constBits() + offset;
+  GifPalette local = palette;
+  if (!gifOptions.sharedPalette) {
+    local.build(pixels, frame.width, frame.height, stride, GIF_COLORS - 1);
+  }
+  std::vector<std::uint8_t> indices;
+  local.map(pixels, frame.width, frame.height, stride, gifOptions.dither,
+            indices);
+  frame.palette = local.getColors();
+
+  if (!prior.isNull()) {
+    frame.transparent = local.size();
+    frame.palette.insert(frame.palette.end(), {0, 0, 0});
+    const std::uint8_t *old = prior.constBits() + offset;
+    for (int y = 0; y < frame.height; ++y) {
+      const std::uint8_t *row = pixels + static_cast<std::size_t>(y) * stride;
+      const std::uint8_t *oldRow = old + static_cast<std::size_t>(y) * stride;
+      std::uint8_t *out =
+          indices.data() + static_cast<std::size_t>(y) * frame.width;
+      for (int x = 0; x < frame.width; ++x) {
+        if (std::memcmp(row + 3 * x, oldRow + 3 * x, 3) == 0) {
+          out[x] = static_cast<std::uint8_t>(frame.transparent);
+        }
+      }
+    }
+  }
+  GifWriter::compress(indices, frame);
+  return frame;
+}
+
+QRect VideoEncoder::changedRect(const QImage &image, const QImage &prior) {
+  if (prior.isNull() || prior.size() != image.size()) return image.rect();
+  std::size_t rowBytes = static_cast<std::size_t>(image.width()) * 3;
+  auto changed = [&image, &prior, rowBytes](int y) {
+    return std::memcmp(image.constScanLine(y), prior.constScanLine(y),
+                       rowBytes) != 0;
+  };
+  int top = 0;
+  while (top < image.height() && !changed(top)) ++top;
+  if (top == image.height()) return QRect();
+  int bottom = image.height() - 1;
+  while (!changed(bottom)) --bottom;
+
+  int left = image.width();
+  int right = -1;
+  for (int y = top; y <= bottom; ++y) {
+    const uchar *row = image.constScanLine(y);
+    const uchar *oldRow = prior.constScanLine(y);
+    int x = 0;
+    while (x < left && std::memcmp(row + 3 * x, oldRow + 3 * x, 3) == 0) ++x;
+    left = std::min(left, x);
+    x = image.width() - 1;
+    while (x > right && std::memcmp(row + 3 * x, oldRow + 3 * x, 3) == 0) --x;
+    right = std::max(right, x);
+  }
+  return QRect(QPoint(left, top), QPoint(right, bottom));
+}
+
+}  // namespace s21
\ No newline at end of file
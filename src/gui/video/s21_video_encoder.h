@@ -0,0 +1,154 @@
+/// @mainpage
+/// @file s21_video_encoder.h
+/// @author machelch
+/// @brief 3D viewer
+/// @version 1.0
+/// @date 2024-11-12
+///
+/// @copyright Copyright (c) 2024
+
+#ifndef S21_VIDEO_ENCODER_H
+#define S21_VIDEO_ENCODER_H
+
+#include <opencv2/opencv.hpp>
+
+#include "../../common/s21_parallel.h"
+#include "../../common/s21_spsc_queue.h"
+#include "../s21_gui_defines.h"
+#include "s21_avi_writer.h"
+#include "s21_gif_palette.h"
+#include "s21_gif_writer.h"
+
+namespace s21 {
+
+/// @brief Формат видео, выбирается по расширению файла
+enum VideoFormat_e { Mjpeg_e, Gif_e };
+
+/// @brief Параметры кодирования GIF
+struct GifOptions_t {
+  /// @brief Одна палитра на все видео, строится по первому кадру
+  bool sharedPalette = false;
+  /// @brief Упорядоченное псевдосмешивание
+  bool dither = true;
+  /// @brief Наибольшая сторона кадра, больший кадр уменьшается
+  int maxSide = GIF_MAX_SIDE;
+};
+
+/// @brief Поток кодирования видео.
+/// Поток GUI кладет кадры в ограниченную очередь без блокировок, поток
+/// кодирования забирает все накопившиеся кадры, сжимает их в JPEG
+/// параллельно и по порядку дописывает в AVI. Кадры MJPG независимы, поэтому
+/// результат не зависит от кол-ва потоков. Для файла .gif кадры так же
+/// параллельно квантуются и сжимаются LZW, кадр кодирует только область,
+/// изменившуюся с прошлого кадра, а неизменные пиксели в ней прозрачны.
+/// Память ограничена глубиной очереди и одним прошлым кадром, а не длиной
+/// видео.
+class VideoEncoder : public QThread {
+  Q_OBJECT
+ public:
+  /// @brief Конструктор, поток запускается через start()
+  /// @param path Путь к файлу видео
+  /// @param fps Кадров в секунду
+  /// @param depth Глубина очереди кадров
+  /// @param threads Потоков сжатия, 0 - по числу ядер
+  VideoEncoder(const QString &path, int fps,
+               std::size_t depth = VIDEO_QUEUE_DEPTH, std::size_t threads = 0);
+  /// @brief Деструктор, дописывает очередь и останавливает поток
+  ~VideoEncoder();
+
+  /// @brief Передача кадра на кодирование, вызывается из потока GUI
+  /// @param frame Кадр
+  /// @return false, если очередь заполнена и кадр не принят
+  bool pushFrame(QImage frame);
+  /// @brief Завершение записи после кодирования принятых кадров
+  void finish();
+  /// @brief Установка параметров GIF, вызывается до start()
+  /// @param options Параметры
+  void setGifOptions(const GifOptions_t &options);
+  /// @brief Записано ли видео, проверяется после finished()
+  /// @return false, если файл не открылся, кадр не записался, например при
+  /// заполненном диске или пределе размера AVI, или файл не закрылся
+  bool succeeded() const;
+
+ signals:
+  /// @brief Сигнал о закодированном кадре
+  /// @param frames Кол-во закодированных кадров
+  void frameEncoded(int frames);
+  /// @brief Сигнал о завершении кодирования, посылается до finished()
+  /// @param frames Кол-во закодированных кадров
+  /// @param framesPerSecond Скорость сжатия и записи, кадров в секунду
+  void encodingFinished(int frames, double framesPerSecond);
+
+ protected:
+  /// @brief Цикл кодирования
+  void run() override;
+
+ private:
+  /// @brief Сжатие и запись пачки кадров, файл открывается по размеру
+  /// первого кадра. После ошибки записи кадры не кодируются
+  /// @param frames Кадры по порядку
+  void encode(const std::vector<QImage> &frames);
+  /// @brief Открытие файла, размер GIF ограничивается GifOptions_t::maxSide
+  /// @param frameSize Размер первого кадра
+  void open(const QSize &frameSize);
+  /// @brief Сжатие и запись пачки кадров GIF
+  /// @param frames Кадры по порядку
+  /// @param workers Кол-во потоков
+  /// @param timer Таймер кодирования пачки
+  void encodeGif(const std::vector<QImage> &frames, std::size_t workers,
+                 QElapsedTimer &timer);
+  /// @brief Учет записанного кадра
+  /// @param timer Таймер кодирования, перезапускается
+  void frameWritten(QElapsedTimer &timer);
+  /// @brief Сжатие кадра в JPEG
+  /// @param frame Кадр
+  /// @return Кадр в формате JPEG
+  std::vector<uchar> compress(const QImage &frame) const;
+  /// @brief Квантование и сжатие кадра GIF
+  /// @param image Кадр RGB888 размера видео
+  /// @param prior Прошлый кадр, пустой для первого кадра
+  /// @return Сжатый кадр
+  GifFrame_t compressGif(const QImage &image, const QImage &prior) const;
+  /// @brief Область, в которой кадр отличается от прошлого
+  /// @param image Кадр
+  /// @param prior Прошлый кадр
+  /// @return Область, весь кадр без прошлого, пустая без изменений
+  static QRect changedRect(const QImage &image, const QImage &prior);
+
+  /// @brief Путь к файлу видео
+  QString path;
+  /// @brief Кадров в секунду
+  int fps = FPS;
+  /// @brief Очередь кадров
+  SpscQueue<QImage> queue;
+  /// @brief Кол-во кадров в очереди и сигнал завершения
+  QSemaphore available;
+  /// @brief Новых кадров не будет
+  std::atomic<bool> finishing{false};
+  /// @brief Запись не удалась, оставшиеся кадры отбрасываются
+  std::atomic<bool> failed{false};
+  /// @brief Потоков сжатия
+  std::size_t threads = 1;
+  /// @brief Формат видео
+  VideoFormat_e format = VideoFormat_e::Mjpeg_e;
+  /// @brief Запись AVI
+  AviWriter avi;
+  /// @brief Запись GIF
+  GifWriter gif;
+  /// @brief Параметры GIF
+  GifOptions_t gifOptions;
+  /// @brief Общая палитра GIF
+  GifPalette palette;
+  /// @brief Последний кадр прошлой пачки GIF
+  QImage previous;
+  /// @brief Время сжатия и записи, нс
+  qint64 encodeTime = 0;
+  /// @brief Размер видео
+  QSize size;
+  /// @brief Кол-во закодированных кадров
+  int encoded = 0;
+};
+
+}  // namespace s21
+
+#endif
\ No newline at end of file
@@ -86,4 +86,490 @@ TEST(Viewer, RESET) {
   mat.setIdentity();
   EXPECT_EQ(controller->getTransformation(), mat);
   delete controller;
+}
+
+TEST(Viewer, BATCH_TRANSFORM) {
+  s21::Controller *single = new s21::Controller();
+  s21::Controller *batch = new s21::Controller();
+  single->applyTransformation(s21::TransformationName_e::RotateY, true, 30);
+  single->applyTransformation(s21::TransformationName_e::TranslationX, true,
+                              0.5);
+  single->applyTransformation(s21::TransformationName_e::Scale, false, 1);
+  batch->applyTransformations(
+      {{s21::TransformationName_e::RotateY, true, 30},
+       {s21::TransformationName_e::TranslationX, true, 0.5},
+       {s21::TransformationName_e::Scale, false, 1}});
+  EXPECT_EQ(single->getTransformation(), batch->getTransformation());
+  delete single;
+  delete batch;
+}
+
+TEST(Viewer, ROTATE_90) {
+  const s21::TransformationName_e axes[3] = {
+      s21::TransformationName_e::RotateX, s21::TransformationName_e::RotateY,
+      s21::TransformationName_e::RotateZ};
+  for (int axis = 0; axis < 3; ++axis) {
+    s21::Controller *controller = new s21::Controller();
+    controller->applyTransformation(axes[axis], true, 90);
+    s21::Matrix quarter = controller->getTransformation();
+    EXPECT_NEAR(quarter[axis][axis], 1.0f, 1e-6);
+    EXPECT_NEAR(quarter[(axis + 1) % 3][(axis + 1) % 3], 0.0f, 1e-6);
+    EXPECT_NEAR(std::abs(quarter[(axis + 1) % 3][(axis + 2) % 3]), 1.0f,
+                1e-6);
+    controller->applyTransformation(axes[axis], true, 90);
+    s21::Matrix half = controller->getTransformation();
+    EXPECT_NEAR(half[(axis + 1) % 3][(axis + 1) % 3], -1.0f, 1e-6);
+    EXPECT_NEAR(half[(axis + 2) % 3][(axis + 2) % 3], -1.0f, 1e-6);
+    delete controller;
+  }
+  s21::Controller *controller = new s21::Controller();
+  for (int i = 0; i < 20; ++i) {
+    controller->applyTransformation(s21::TransformationName_e::Scale, true,
+                                    -1);
+  }
+  EXPECT_GT(controller->getTransformation()[0][0], 1e-6f);
+  delete controller;
+}
+
+TEST(Viewer, MESH_TRIANGULATE) {
+  std::vector<s21::Vertex_t> vertices = {{0, 0, 0}, {2, 0, 0}, {2, 1, 0},
+                                         {1, 1, 0}, {1, 2, 0}, {0, 2, 0}};
+  std::vector<s21::Face_t> faces = {{{0, 1, 2, 3, 4, 5}}, {{0, 1, 2, 3}}};
+  s21::Mesh mesh;
+  mesh.build(vertices, faces);
+  const std::vector<s21::Triangle_t> &triangles = mesh.getTriangles();
+  ASSERT_EQ(triangles.size(), 6u);
+  float area = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    const s21::Vertex_t &a = vertices[triangles[i].a];
+    const s21::Vertex_t &b = vertices[triangles[i].b];
+    const s21::Vertex_t &c = vertices[triangles[i].c];
+    float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    EXPECT_GT(cross, 0);
+    area += cross / 2;
+  }
+  EXPECT_NEAR(area, 3.0f, MY_EPS);
+  int polygonEdges = 0;
+  for (unsigned char mask : mesh.getEdgeMasks()) {
+    polygonEdges += (mask & EDGE_AB ? 1 : 0) + (mask & EDGE_BC ? 1 : 0) +
+                    (mask & EDGE_CA ? 1 : 0);
+  }
+  EXPECT_EQ(polygonEdges, 6 + 4);
+  for (const s21::Vertex_t &normal : mesh.getNormals()) {
+    EXPECT_NEAR(normal.z, 1.0f, MY_EPS);
+  }
+}
+
+TEST(Viewer, MESH_NORMALS) {
+  s21::Controller *controller = new s21::Controller();
+  EXPECT_EQ(controller->loadModel("./tests/c.obj"), s21::Status_e::OK);
+  EXPECT_EQ(controller->getTriangles().size(), controller->getFaces().size());
+  ASSERT_EQ(controller->getNormals().size(),
+            controller->getVertices().size());
+  for (const s21::Vertex_t &normal : controller->getNormals()) {
+    EXPECT_NEAR(normal.x * normal.x + normal.y * normal.y +
+                    normal.z * normal.z,
+                1.0f, 1e-5);
+  }
+  delete controller;
+}
+TEST(Viewer, EDGE_CLUSTERS) {
+  std::vector<s21::Vertex_t> vertices;
+  for (int x = 0; x < 64; ++x) {
+    for (int y = 0; y < 64; ++y) {
+      for (int z = 0; z < 16; ++z) {
+        vertices.push_back({x * 1.0f, y * 1.0f, z * 1.0f});
+      }
+    }
+  }
+  std::vector<s21::Edge_t> edges;
+  for (unsigned int i = 0; i + 1 < vertices.size(); ++i) {
+    edges.push_back({i, i + 1});
+  }
+  s21::EdgeClusters clusters;
+  clusters.build(vertices, edges);
+  const std::vector<s21::Edge_t> &sorted = clusters.getEdges();
+  ASSERT_EQ(sorted.size(), edges.size());
+  EXPECT_GT(clusters.getClusters().size(), 1u);
+  std::size_t offset = 0;
+  std::vector<bool> seen(vertices.size(), false);
+  for (const s21::Cluster_t &cluster : clusters.getClusters()) {
+    EXPECT_EQ(cluster.offset, offset);
+    offset += cluster.count;
+    for (std::size_t i = cluster.offset; i < offset; ++i) {
+      for (unsigned int index : {sorted[i].indFirst, sorted[i].indSecond}) {
+        const s21::Vertex_t &v = vertices[index];
+        EXPECT_TRUE(v.x >= cluster.min.x && v.x <= cluster.max.x &&
+                    v.y >= cluster.min.y && v.y <= cluster.max.y &&
+                    v.z >= cluster.min.z && v.z <= cluster.max.z);
+      }
+      EXPECT_EQ(sorted[i].indSecond, sorted[i].indFirst + 1);
+      seen[sorted[i].indFirst] = true;
+    }
+  }
+  EXPECT_EQ(offset, edges.size());
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), true),
+            static_cast<long>(edges.size()));
+}
+
+TEST(Viewer, EDGE_STRIPS) {
+  const unsigned int size = 200;
+  std::vector<s21::Vertex_t> vertices;
+  std::set<std::pair<unsigned int, unsigned int>> expected;
+  std::vector<s21::Edge_t> edges;
+  for (unsigned int x = 0; x < size; ++x) {
+    for (unsigned int y = 0; y < size; ++y) {
+      vertices.push_back({x * 1.0f, y * 1.0f, 0.0f});
+      unsigned int index = x * size + y;
+      if (y + 1 < size) edges.push_back({index, index + 1});
+      if (x + 1 < size) edges.push_back({index, index + size});
+    }
+  }
+  for (const s21::Edge_t &edge : edges) {
+    expected.insert({edge.indFirst, edge.indSecond});
+  }
+  s21::EdgeClusters clusters;
+  clusters.build(vertices, edges);
+  const std::vector<unsigned int> &indices = clusters.getStripIndices();
+  const std::vector<std::size_t> &starts = clusters.getStripStarts();
+  EXPECT_LT(indices.size(), edges.size() * 2 * 3 / 4);
+  ASSERT_EQ(starts.back(), indices.size());
+  std::set<std::pair<unsigned int, unsigned int>> found;
+  for (std::size_t strip = 0; strip + 1 < starts.size(); ++strip) {
+    std::size_t end = starts[strip + 1] - 1;
+    EXPECT_EQ(indices[end], STRIP_RESTART);
+    for (std::size_t i = starts[strip]; i + 1 < end; ++i) {
+      unsigned int a = std::min(indices[i], indices[i + 1]);
+      unsigned int b = std::max(indices[i], indices[i + 1]);
+      EXPECT_TRUE(found.insert({a, b}).second);
+    }
+  }
+  EXPECT_EQ(found, expected);
+}
+
+TEST(Viewer, POINT_CLOUD) {
+  s21::Controller *controller = new s21::Controller();
+  EXPECT_EQ(controller->loadModel("./tests/points.obj"), s21::Status_e::OK);
+  EXPECT_TRUE(controller->isPointCloud());
+  EXPECT_EQ(controller->getVertices().size(), 8u);
+  EXPECT_TRUE(controller->getEdgeStrips().empty());
+  controller->setPointCloudResolution(1);
+  EXPECT_EQ(controller->getDisplayVertices().size(), 1u);
+  controller->setPointCloudResolution(0);
+  EXPECT_EQ(controller->getDisplayVertices().size(), 8u);
+  delete controller;
+}
+
+TEST(Viewer, SEPARATE_MODELS) {
+  s21::Controller first;
+  s21::Controller second;
+  ASSERT_EQ(first.loadModel("./tests/c.obj"), s21::Status_e::OK);
+  std::vector<s21::Vertex_t> vertices = first.getVertices();
+  std::size_t edges = first.getEdges().size();
+  ASSERT_EQ(second.loadModel("./tests/points.obj"), s21::Status_e::OK);
+  EXPECT_TRUE(second.isPointCloud());
+  EXPECT_FALSE(first.isPointCloud());
+  ASSERT_EQ(first.getVertices().size(), vertices.size());
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    EXPECT_FLOAT_EQ(first.getVertices()[i].x, vertices[i].x);
+    EXPECT_FLOAT_EQ(first.getVertices()[i].y, vertices[i].y);
+    EXPECT_FLOAT_EQ(first.getVertices()[i].z, vertices[i].z);
+  }
+  EXPECT_EQ(first.getEdges().size(), edges);
+  EXPECT_TRUE(second.getEdges().empty());
+  EXPECT_NE(first.getInfo().bounds.max.y, second.getInfo().bounds.max.y);
+}
+
+TEST(Viewer, VOXEL_GRID) {
+  const unsigned int size = 50;
+  std::vector<s21::Vertex_t> points;
+  for (unsigned int x = 0; x < size; ++x) {
+    for (unsigned int y = 0; y < size; ++y) {
+      for (unsigned int z = 0; z < size; ++z) {
+        points.push_back({x * 1.0f, y * 1.0f, z * 1.0f});
+      }
+    }
+  }
+  s21::VoxelGrid grid;
+  grid.build(points, 5);
+  const std::vector<s21::Vertex_t> &voxels = grid.getPoints();
+  ASSERT_EQ(voxels.size(), 125u);
+  std::set<std::tuple<int, int, int>> cells;
+  for (const s21::Vertex_t &voxel : voxels) {
+    cells.insert({static_cast<int>(voxel.x / 9.8f),
+                  static_cast<int>(voxel.y / 9.8f),
+                  static_cast<int>(voxel.z / 9.8f)});
+  }
+  EXPECT_EQ(cells.size(), 125u);
+  grid.build(points, 0);
+  EXPECT_EQ(grid.getPoints().size(), points.size());
+}
+
+TEST(Viewer, RELEASE_GEOMETRY) {
+  s21::Controller *controller = new s21::Controller();
+  ASSERT_EQ(controller->loadModel("./tests/c.obj"), s21::Status_e::OK);
+  s21::ModelInfo_t info = controller->getInfo();
+  controller->releaseGeometry();
+  EXPECT_FALSE(controller->isGeometryLoaded());
+  EXPECT_EQ(controller->getInfo().vertices, info.vertices);
+  EXPECT_EQ(controller->getInfo().edges, info.edges);
+  EXPECT_FALSE(controller->isPointCloud());
+  EXPECT_FALSE(controller->isGeometryLoaded());
+  EXPECT_EQ(controller->getVertices().size(), info.vertices);
+  EXPECT_EQ(controller->getEdges().size(), info.edges);
+  EXPECT_TRUE(controller->isGeometryLoaded());
+  delete controller;
+}
+
+TEST(Viewer, RESTORE_GEOMETRY) {
+  const char *path = "./tests/restore.obj";
+  std::ofstream(path) << std::ifstream("./tests/c.obj").rdbuf();
+  s21::Controller *controller = new s21::Controller();
+  ASSERT_EQ(controller->loadModel(path), s21::Status_e::OK);
+  std::vector<s21::Vertex_t> vertices = controller->getVertices();
+  std::vector<s21::Face_t> faces = controller->getFaces();
+  std::size_t edges = controller->getEdges().size();
+  controller->releaseGeometry();
+  EXPECT_FALSE(controller->isGeometryLoaded());
+  EXPECT_EQ(controller->restoreGeometry(), s21::Status_e::OK);
+  EXPECT_TRUE(controller->isGeometryLoaded());
+  EXPECT_EQ(controller->getVertices().size(), vertices.size());
+  controller->releaseGeometry();
+  std::ofstream(path) << std::ifstream("./tests/points.obj").rdbuf();
+  std::remove(path);
+  EXPECT_EQ(controller->restoreGeometry(), s21::Status_e::OK);
+  ASSERT_EQ(controller->getVertices().size(), vertices.size());
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    EXPECT_FLOAT_EQ(controller->getVertices()[i].y, vertices[i].y);
+  }
+  ASSERT_EQ(controller->getFaces().size(), faces.size());
+  for (std::size_t i = 0; i < faces.size(); ++i) {
+    EXPECT_EQ(controller->getFaces()[i].vertexIndex, faces[i].vertexIndex);
+  }
+  EXPECT_EQ(controller->getEdges().size(), edges);
+  EXPECT_EQ(controller->getInfo().vertices, vertices.size());
+  delete controller;
+}
+
+TEST(Viewer, LOAD_OPTIONS) {
+  s21::Controller *controller = new s21::Controller();
+  ASSERT_EQ(controller->loadModel("./tests/c.obj"), s21::Status_e::OK);
+  std::vector<s21::Edge_t> edges = controller->getEdges();
+  std::size_t faces = controller->getFaces().size();
+  s21::LoadOptions_t options;
+  options.faces = false;
+  options.edges = false;
+  ASSERT_EQ(controller->loadModel("./tests/c.obj", options),
+            s21::Status_e::OK);
+  EXPECT_EQ(controller->getInfo().faces, faces);
+  EXPECT_EQ(controller->getInfo().edges, edges.size());
+  EXPECT_FLOAT_EQ(controller->getInfo().bounds.max.y, 2.0f);
+  EXPECT_EQ(controller->getEdges().size(), edges.size());
+  EXPECT_EQ(controller->getFaces().size(), faces);
+  std::set<std::pair<unsigned int, unsigned int>> unique;
+  for (const s21::Edge_t &edge : edges) {
+    unique.insert({edge.indFirst, edge.indSecond});
+  }
+  EXPECT_EQ(controller->getUniqueEdges().size(), unique.size());
+  delete controller;
+}
+
+TEST(Viewer, LAZY_FACES_FILE_CHANGED) {
+  const char *path = "./tests/lazy.obj";
+  std::ofstream(path) << std::ifstream("./tests/c.obj").rdbuf();
+  s21::Controller *controller = new s21::Controller();
+  ASSERT_EQ(controller->loadModel("./tests/c.obj"), s21::Status_e::OK);
+  std::vector<s21::Face_t> faces = controller->getFaces();
+  std::size_t edges = controller->getEdges().size();
+  s21::LoadOptions_t options;
+  options.faces = false;
+  options.edges = false;
+  ASSERT_EQ(controller->loadModel(path, options), s21::Status_e::OK);
+  std::ofstream(path) << std::ifstream("./tests/points.obj").rdbuf();
+  EXPECT_EQ(controller->getEdges().size(), edges);
+  ASSERT_EQ(controller->getFaces().size(), faces.size());
+  for (std::size_t i = 0; i < faces.size(); ++i) {
+    EXPECT_EQ(controller->getFaces()[i].vertexIndex, faces[i].vertexIndex);
+  }
+  std::remove(path);
+  delete controller;
+}
+
+TEST(Viewer, PARALLEL_FOR_CHUNKS) {
+  const std::size_t count = 1000;
+  const std::size_t chunks = 7;
+  std::vector<std::size_t> owners(count, chunks);
+  std::vector<std::size_t> nested(chunks, 0);
+  s21::parallelForChunks(
+      count, chunks,
+      [&owners, &nested](std::size_t chunk, std::size_t begin,
+                         std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) owners[i] = chunk;
+        std::atomic<std::size_t> sum{0};
+        s21::parallelForChunks(
+            end - begin, 3,
+            [&sum](std::size_t, std::size_t first, std::size_t last) {
+              sum += last - first;
+            });
+        nested[chunk] = sum;
+      });
+  for (std::size_t chunk = 0; chunk < chunks; ++chunk) {
+    std::size_t begin = count * chunk / chunks;
+    std::size_t end = count * (chunk + 1) / chunks;
+    for (std::size_t i = begin; i < end; ++i) EXPECT_EQ(owners[i], chunk);
+    EXPECT_EQ(nested[chunk], end - begin);
+  }
+}
+
+TEST(Viewer, SPSC_QUEUE) {
+  s21::SpscQueue<std::size_t> queue(4);
+  std::size_t value = 0;
+  for (std::size_t i = 0; i < queue.capacity(); ++i) {
+    EXPECT_TRUE(queue.tryPush(std::size_t(i)));
+  }
+  EXPECT_FALSE(queue.tryPush(std::size_t(4)));
+  EXPECT_TRUE(queue.tryPop(value));
+  EXPECT_EQ(value, 0u);
+  while (queue.tryPop(value)) {
+  }
+  EXPECT_EQ(value, 3u);
+
+  const std::size_t count = 10000;
+  std::thread producer([&queue, count]() {
+    for (std::size_t i = 0; i < count;) {
+      if (queue.tryPush(std::size_t(i))) {
+        ++i;
+      } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+      }
+    }
+  });
+  bool ordered = true;
+  for (std::size_t expected = 0; expected < count;) {
+    if (queue.tryPop(value)) {
+      ordered = ordered && value == expected++;
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_FALSE(queue.tryPop(value));
+}
+
+TEST(Viewer, ANIMATION) {
+  s21::Animation animation = s21::Animation::turntable(4.0f, 1.0f, 1.0f, 2.0f);
+  EXPECT_FLOAT_EQ(animation.getDuration(), 4.0f);
+  EXPECT_EQ(animation.frameCount(25), 100u);
+
+  s21::Keyframe_t frame = animation.sample(2.0f);
+  EXPECT_FLOAT_EQ(frame.rotation.y, 180.0f);
+  EXPECT_FLOAT_EQ(frame.scale, 1.5f);
+  EXPECT_FLOAT_EQ(animation.sample(10.0f).scale, 2.0f);
+  EXPECT_TRUE(animation.getSteps(0.0f).empty());
+
+  s21::Controller controller;
+  controller.clearTransformation();
+  controller.applyTransformations(animation.getSteps(1.0f));
+  s21::Matrix matrix = controller.getTransformation();
+  EXPECT_NEAR(matrix[0][2], 1.25f, 1e-5);
+  EXPECT_NEAR(matrix[2][0], -1.25f, 1e-5);
+  EXPECT_NEAR(matrix[1][1], 1.25f, 1e-5);
+}
+
+TEST(Viewer, TRANSFORM_SEQUENCE) {
+  std::vector<s21::TransformationStep_t> steps;
+  EXPECT_TRUE(s21::parseTransformations("ry=90,s=2,tx=0.5", steps));
+  ASSERT_EQ(steps.size(), 3u);
+  EXPECT_EQ(steps[0].transformation, s21::RotateY);
+  EXPECT_EQ(steps[1].transformation, s21::Scale);
+  EXPECT_FLOAT_EQ(steps[1].direction, 1.0f);
+  EXPECT_FLOAT_EQ(steps[2].direction, 0.5f);
+  EXPECT_FALSE(s21::parseTransformations("rx=1,q=2", steps));
+  EXPECT_FALSE(s21::parseTransformations("rx=abc", steps));
+  EXPECT_FALSE(s21::parseTransformations("s=0", steps));
+  EXPECT_EQ(steps.size(), 3u);
+
+  s21::Controller controller;
+  controller.clearTransformation();
+  controller.applyTransformations(steps);
+  s21::Matrix matrix = controller.getTransformation();
+  EXPECT_NEAR(matrix[0][2], 2.0f, 1e-5);
+  EXPECT_NEAR(matrix[1][1], 2.0f, 1e-5);
+}
+
+TEST(Viewer, SOFTWARE_RENDERER) {
+  s21::Matrix model(4, 4);
+  model.setIdentity();
+  s21::SoftwareRenderer renderer;
+  renderer.resize(200, 130);
+  float aspect = 200.0f / 130.0f;
+  std::vector<s21::Vertex_t> vertices = {
+      {-aspect, -1.0f, 0.0f}, {aspect, 1.0f, 0.0f}};
+  std::vector<unsigned int> strips = {0, 1, STRIP_RESTART};
+  s21::RasterSettings_t settings;
+  renderer.render(vertices, strips, model, settings);
+  EXPECT_EQ(renderer.getEdgeCount(), 1u);
+  const std::vector<std::uint8_t> &pixels = renderer.getPixels();
+  auto red = [&pixels](int x, int y) { return pixels[(y * 200 + x) * 3]; };
+  for (int x = 0; x < 200; ++x) {
+    int lit = 0;
+    for (int y = 0; y < 130; ++y) lit += red(x, y) == 255;
+    EXPECT_EQ(lit, 1);
+  }
+  EXPECT_EQ(red(0, 129), 255);
+  EXPECT_EQ(red(199, 0), 255);
+
+  vertices = {{-1.0f, 0.0f, 0.5f}, {1.0f, 0.0f, 0.5f}, {0.0f, 0.0f, -0.5f}};
+  settings.vertexColor[0] = 100;
+  settings.pointSize = 9.0f;
+  settings.roundPoints = false;
+  renderer.render(vertices, strips, model, settings);
+  EXPECT_EQ(red(100, 65), 255);
+  EXPECT_EQ(red(100, 62), 100);
+  EXPECT_EQ(red(150, 40), 0);
+}
+
+TEST(Viewer, QOI_ROUND_TRIP) {
+  const int width = 70;
+  const int height = 5;
+  const int stride = width * 3 + 2;
+  std::vector<std::uint8_t> image(stride * height, 0);
+  std::mt19937 random(21);
+  for (int x = 0; x < width; ++x) {
+    std::uint8_t *pixel = &image[x * 3];
+    std::memset(pixel, x % 2 ? 0 : 100, 3);
+    std::memset(&image[stride + x * 3], 42, 3);
+    pixel = &image[2 * stride + x * 3];
+    pixel[0] = static_cast<std::uint8_t>(x);
+    pixel[1] = static_cast<std::uint8_t>(x / 2);
+    pixel[2] = static_cast<std::uint8_t>(200 - x);
+    pixel = &image[3 * stride + x * 3];
+    pixel[0] = static_cast<std::uint8_t>(x * 10 + 3);
+    pixel[1] = static_cast<std::uint8_t>(x * 10);
+    pixel[2] = static_cast<std::uint8_t>(x * 10 - 4);
+    for (int c = 0; c < 3; ++c) {
+      image[4 * stride + x * 3 + c] = static_cast<std::uint8_t>(random());
+    }
+  }
+  std::vector<std::uint8_t> data;
+  s21::QoiCodec::encode(image.data(), width, height, stride, data);
+  ASSERT_GT(data.size(), static_cast<std::size_t>(QOI_HEADER + 8));
+  int decodedWidth = 0;
+  int decodedHeight = 0;
+  std::vector<std::uint8_t> pixels;
+  ASSERT_TRUE(s21::QoiCodec::decode(data, decodedWidth, decodedHeight, pixels));
+  ASSERT_EQ(decodedWidth, width);
+  ASSERT_EQ(decodedHeight, height);
+  for (int y = 0; y < height; ++y) {
+    for (int x = 0; x < width; ++x) {
+      const std::uint8_t *source = &image[y * stride + x * 3];
+      const std::uint8_t *decoded = &pixels[(y * width + x) * 4];
+      EXPECT_EQ(std::memcmp(source, decoded, 3), 0) << x << " " << y;
+      EXPECT_EQ(decoded[3], 255) << x << " " << y;
+    }
+  }
+  data.resize(QOI_HEADER + 8);
+  EXPECT_FALSE(s21::QoiCodec::decode(data, decodedWidth, decodedHeight,
+                                     pixels));
 }
\ No newline at end of file
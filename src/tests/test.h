@@ -2,6 +2,7 @@
 #define TEST_H
 
 #include <gtest/gtest.h>
+#include "../common/s21_spsc_queue.h"
 #include "../controller/s21_controller.h"
 
 #endif
\ No newline at end of file